@@ -0,0 +1,199 @@
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <numeric>
+#include <atomic>
+#include <thread>
+#include <cstdint>
+#include <cstdlib>
+#include <chrono>
+#include <random>
+#include "concurrentdsu.h"
+
+// Parallel Boruvka minimum spanning forest.
+// Each round, every component picks its cheapest outgoing edge in parallel,
+// all picked edges are contracted concurrently through a lock-free DSU, and
+// edges that now lie inside one component are dropped. The number of
+// components at least halves per round, so there are O(log n) rounds and no
+// global sort of the edge list.
+// Ties are broken by edge index, which makes every picked set acyclic.
+
+struct Edge {
+    int u, v;
+    long long w;
+};
+
+// Runs f(t, begin, end) on 'num_threads' threads over contiguous parts of [0, n).
+template <typename F>
+void parallel_for(int n, int num_threads, F f) {
+    std::vector<std::thread> threads;
+    for (int t = 1; t < num_threads; ++t) {
+        threads.emplace_back(f, t, (long long)n * t / num_threads,
+                             (long long)n * (t + 1) / num_threads);
+    }
+    f(0, 0, (long long)n / num_threads);
+    for (auto& th : threads) {
+        th.join();
+    }
+}
+
+// Returns the indices of the forest edges, sorted.
+std::vector<int> boruvka(int n, const std::vector<Edge>& edges, int num_threads) {
+    ConcurrentDSU dsu(n);
+    // Cheapest outgoing edge of each component root, -1 if none yet.
+    std::vector<std::atomic<int>> best(n + 1);
+    std::vector<std::vector<int>> picked(num_threads), kept(num_threads);
+
+    // (w, index) is a strict total order on edges.
+    auto lighter = [&](int a, int b) {
+        return edges[a].w < edges[b].w || (edges[a].w == edges[b].w && a < b);
+    };
+    // Lowers best[r] to e unless a lighter edge is already there.
+    auto offer = [&](int r, int e) {
+        int cur = best[r].load(std::memory_order_relaxed);
+        while ((cur == -1 || lighter(e, cur)) &&
+               !best[r].compare_exchange_weak(cur, e, std::memory_order_relaxed)) {
+        }
+    };
+
+    std::vector<int> active(edges.size());
+    std::iota(active.begin(), active.end(), 0);
+    std::vector<int> forest;
+
+    while (!active.empty()) {
+        parallel_for(n + 1, num_threads, [&](int, int begin, int end) {
+            for (int i = begin; i < end; ++i) {
+                best[i].store(-1, std::memory_order_relaxed);
+            }
+        });
+
+        // 1. Drop edges inside one component, offer the rest to both ends.
+        parallel_for(active.size(), num_threads, [&](int t, int begin, int end) {
+            kept[t].clear();
+            for (int k = begin; k < end; ++k) {
+                int e = active[k];
+                int ru = dsu.find(edges[e].u), rv = dsu.find(edges[e].v);
+                if (ru == rv) {
+                    continue;
+                }
+                kept[t].push_back(e);
+                offer(ru, e);
+                offer(rv, e);
+            }
+        });
+
+        // 2. Contract every picked edge. An edge picked by both of its
+        // components is only counted by the unite() that merges them.
+        parallel_for(n + 1, num_threads, [&](int t, int begin, int end) {
+            picked[t].clear();
+            for (int r = begin; r < end; ++r) {
+                int e = best[r].load(std::memory_order_relaxed);
+                if (e != -1 && dsu.unite(edges[e].u, edges[e].v)) {
+                    picked[t].push_back(e);
+                }
+            }
+        });
+
+        size_t merged = 0;
+        for (const auto& p : picked) {
+            forest.insert(forest.end(), p.begin(), p.end());
+            merged += p.size();
+        }
+        if (merged == 0) {
+            break;
+        }
+
+        // 3. The surviving edges become the next round's input.
+        active.clear();
+        for (const auto& k : kept) {
+            active.insert(active.end(), k.begin(), k.end());
+        }
+    }
+
+    std::sort(forest.begin(), forest.end());
+    return forest;
+}
+
+#ifdef BENCHMARK
+// Times Boruvka on a random graph at several thread counts and checks the
+// forest weight against a serial Kruskal.
+void run_benchmark() {
+    const int n = 1000000, m = 10000000;
+    std::mt19937 rng(2024);
+    std::vector<Edge> edges(m);
+    for (auto& e : edges) {
+        e = {(int)(rng() % n) + 1, (int)(rng() % n) + 1, (long long)(rng() % 1000000)};
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<int> order(m);
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&](int a, int b) {
+        return edges[a].w < edges[b].w || (edges[a].w == edges[b].w && a < b);
+    });
+    std::vector<int> p(n + 1, -1);
+    auto find = [&](int x) {
+        while (p[x] >= 0) {
+            if (p[p[x]] >= 0) p[x] = p[p[x]];
+            x = p[x];
+        }
+        return x;
+    };
+    long long kruskal_weight = 0;
+    for (int e : order) {
+        int a = find(edges[e].u), b = find(edges[e].v);
+        if (a != b) {
+            if (p[a] > p[b]) std::swap(a, b);
+            p[a] += p[b];
+            p[b] = a;
+            kruskal_weight += edges[e].w;
+        }
+    }
+    double kruskal = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::cout << "kruskal: " << kruskal << " s\n";
+
+    for (int threads : {1, 2, 4, 8, 16, 32, 64}) {
+        start = std::chrono::steady_clock::now();
+        std::vector<int> forest = boruvka(n, edges, threads);
+        double secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        long long weight = 0;
+        for (int e : forest) weight += edges[e].w;
+        std::cout << "boruvka " << threads << " threads: " << secs << " s, speedup over kruskal "
+                  << kruskal / secs << (weight == kruskal_weight ? "" : " (MISMATCH)") << "\n";
+    }
+}
+#endif
+
+// Usage: ./boruvka [threads]   (defaults to all hardware threads)
+int main(int argc, char* argv[]) {
+#ifdef BENCHMARK
+    run_benchmark();
+    return 0;
+#endif
+    int num_threads = argc > 1 ? std::atoi(argv[1]) : std::thread::hardware_concurrency();
+    num_threads = std::max(1, num_threads);
+
+    // Fast I/O
+    std::ios_base::sync_with_stdio(false);
+    std::cin.tie(NULL);
+
+    int n, m;
+    std::cin >> n >> m; // N nodes (1-based), M weighted edges "u v w"
+    std::vector<Edge> edges(m);
+    for (int i = 0; i < m; ++i) {
+        std::cin >> edges[i].u >> edges[i].v >> edges[i].w;
+    }
+
+    std::vector<int> forest = boruvka(n, edges, num_threads);
+
+    long long total = 0;
+    for (int e : forest) {
+        total += edges[e].w;
+    }
+    std::cout << total << " " << forest.size() << "\n";
+    for (int e : forest) {
+        std::cout << edges[e].u << " " << edges[e].v << " " << edges[e].w << "\n";
+    }
+
+    return 0;
+}
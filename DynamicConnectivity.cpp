@@ -0,0 +1,169 @@
+#include <iostream>
+#include <vector>
+#include <map>
+#include <algorithm>
+
+// Offline fully dynamic connectivity.
+// UnionFind.cpp only handles deletions of edges that never come back. Here
+// edges can be added and removed in any order, interleaved with queries for
+// the number of connected components.
+//
+// Every edge is alive during some interval of time [l, r). Each interval is
+// put on the O(log q) segment-tree nodes that cover it, and a DFS over the
+// tree unites those edges on the way down and undoes them on the way up.
+// Total cost is O((m + q) * log q * log n).
+
+// Union by size without path compression, so every union can be undone.
+// Same packed layout as UnionFind.cpp: p[i] < 0 marks a root of size -p[i].
+struct RollbackDSU {
+    std::vector<int> p;
+    // (attached root, its old p value) per unite(); root -1 if nothing changed.
+    std::vector<std::pair<int, int>> history;
+    int components;
+
+    RollbackDSU(int n) {
+        p.assign(n + 1, -1);
+        components = n;
+    }
+
+    // No path compression: depth stays O(log n) thanks to union by size.
+    int find(int i) const {
+        while (p[i] >= 0) {
+            i = p[i];
+        }
+        return i;
+    }
+
+    void unite(int i, int j) {
+        i = find(i);
+        j = find(j);
+        if (i == j) {
+            history.push_back({-1, 0});
+            return;
+        }
+        if (p[i] > p[j]) {
+            std::swap(i, j);
+        }
+        history.push_back({j, p[j]});
+        p[i] += p[j];
+        p[j] = i;
+        components--;
+    }
+
+    // Undoes the most recent unite().
+    void rollback() {
+        auto [j, old] = history.back();
+        history.pop_back();
+        if (j == -1) {
+            return;
+        }
+        int i = p[j];
+        p[i] -= old;
+        p[j] = old;
+        components++;
+    }
+};
+
+int q;
+// tree[v] holds the edges alive during the whole time range of node v.
+std::vector<std::vector<std::pair<int, int>>> tree;
+// Answers for the "?" queries, indexed by time; -1 for other operations.
+std::vector<int> answers;
+
+// Puts edge e on the nodes covering [l, r) within node v = [tl, tr).
+void add_interval(int v, int tl, int tr, int l, int r, std::pair<int, int> e) {
+    if (r <= tl || tr <= l) {
+        return;
+    }
+    if (l <= tl && tr <= r) {
+        tree[v].push_back(e);
+        return;
+    }
+    int tm = (tl + tr) / 2;
+    add_interval(2 * v, tl, tm, l, r, e);
+    add_interval(2 * v + 1, tm, tr, l, r, e);
+}
+
+// Walks the segment tree, applying each node's edges for its subtree only.
+void solve(int v, int tl, int tr, RollbackDSU& dsu, const std::vector<bool>& is_query) {
+    for (const auto& e : tree[v]) {
+        dsu.unite(e.first, e.second);
+    }
+    if (tr - tl == 1) {
+        if (is_query[tl]) {
+            answers[tl] = dsu.components;
+        }
+    } else {
+        int tm = (tl + tr) / 2;
+        solve(2 * v, tl, tm, dsu, is_query);
+        solve(2 * v + 1, tm, tr, dsu, is_query);
+    }
+    for (size_t k = 0; k < tree[v].size(); ++k) {
+        dsu.rollback();
+    }
+}
+
+int main() {
+    // Fast I/O
+    std::ios_base::sync_with_stdio(false);
+    std::cin.tie(NULL);
+
+    // Operations, one per time step:
+    //   + u v  -> add edge (u, v)
+    //   - u v  -> remove one copy of edge (u, v)
+    //   ?      -> print the number of connected components
+    int n;
+    std::cin >> n >> q;
+
+    tree.assign(4 * std::max(q, 1), {});
+    answers.assign(q, -1);
+    std::vector<bool> is_query(q, false);
+
+    // Start times of the copies of each edge that are currently alive.
+    std::map<std::pair<int, int>, std::vector<int>> alive;
+    for (int t = 0; t < q; ++t) {
+        char type;
+        std::cin >> type;
+        if (type == '?') {
+            is_query[t] = true;
+            continue;
+        }
+        int u, v;
+        std::cin >> u >> v;
+        if (u > v) {
+            std::swap(u, v);
+        }
+        if (type == '+') {
+            alive[{u, v}].push_back(t);
+        } else {
+            auto it = alive.find({u, v});
+            if (it == alive.end()) {
+                continue; // Removing an edge that is not there is a no-op.
+            }
+            add_interval(1, 0, q, it->second.back(), t, it->first);
+            it->second.pop_back();
+            if (it->second.empty()) {
+                alive.erase(it);
+            }
+        }
+    }
+    // Edges never removed stay alive until the end.
+    for (const auto& [e, starts] : alive) {
+        for (int start : starts) {
+            add_interval(1, 0, q, start, q, e);
+        }
+    }
+
+    if (q > 0) {
+        RollbackDSU dsu(n);
+        solve(1, 0, q, dsu, is_query);
+    }
+
+    for (int t = 0; t < q; ++t) {
+        if (is_query[t]) {
+            std::cout << answers[t] << "\n";
+        }
+    }
+
+    return 0;
+}
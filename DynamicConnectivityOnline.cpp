@@ -0,0 +1,467 @@
+#include <iostream>
+#include <vector>
+#include <unordered_map>
+#include <algorithm>
+#include <cstdint>
+#include <chrono>
+#include <random>
+
+// Online fully dynamic connectivity (Holm, de Lichtenberg and Thorup).
+// Unlike DynamicConnectivity.cpp, no query log is needed: every insert,
+// delete, connectivity check and component count is answered immediately.
+// Updates take O(log^2 n) amortized time, queries O(log n).
+//
+// Every edge has a level in [0, L). F_i is a spanning forest of the edges of
+// level >= i, so F_0 ⊇ F_1 ⊇ ... and F_0 is a spanning forest of the graph.
+// A tree of F_i has at most n / 2^i vertices. When a tree edge is deleted, the
+// smaller half is searched for a replacement level by level, and every edge
+// that fails to reconnect is pushed one level up, which pays for the search.
+//
+// Each forest is kept as Euler tour trees: a treap over the tour, holding one
+// node per vertex and one node per direction of every tree edge.
+
+struct HDT {
+    struct Node {
+        int l = 0, r = 0, p = 0;
+        uint32_t pri = 0;
+        int cnt = 0;                // Treap nodes in this subtree
+        int vcnt = 0;               // Vertex nodes in this subtree (= tree size)
+        int id = 0;                 // Vertex for vertex nodes, edge for arc nodes
+        bool vertex = false;
+        bool tree_here = false;     // Arc of a tree edge whose level is this forest's
+        bool nontree_here = false;  // Vertex with non-tree edges at this level
+        bool tree_sub = false, nontree_sub = false;
+    };
+
+    struct Edge {
+        int u, v, level;
+        int copies;                            // Parallel copies of (u, v) currently present
+        bool tree;
+        int pos[2];                            // Index in u's / v's non-tree list
+        std::vector<std::pair<int, int>> arcs; // Arc nodes in F_0 .. F_level
+    };
+
+    int n, levels;
+    // The number of connected components, as in UnionFind.cpp's DSU.
+    int components;
+    std::vector<Node> t;
+    std::vector<int> free_nodes;
+    std::vector<Edge> edges;
+    std::vector<int> free_edges;
+    std::unordered_map<uint64_t, int> edge_id;
+    // nontree[level * (n + 1) + v]: non-tree edges of that level at v
+    std::vector<std::vector<int>> nontree;
+    std::mt19937 rng;
+
+    HDT(int n) : n(n), components(n), rng(12345) {
+        levels = 1;
+        while ((1 << levels) <= n) levels++;
+        // Node 0 is the null node; then one vertex node per (level, vertex).
+        t.resize(1 + levels * (n + 1));
+        for (int i = 0; i < levels; ++i) {
+            for (int v = 1; v <= n; ++v) {
+                int x = vnode(i, v);
+                t[x].pri = rng();
+                t[x].vertex = true;
+                t[x].id = v;
+                pull(x);
+            }
+        }
+        nontree.resize(levels * (n + 1));
+    }
+
+    int vnode(int level, int v) const {
+        return 1 + level * (n + 1) + v;
+    }
+
+    // --- Treap with parent pointers ---
+
+    void pull(int x) {
+        Node& a = t[x];
+        const Node& L = t[a.l];
+        const Node& R = t[a.r];
+        a.cnt = 1 + L.cnt + R.cnt;
+        a.vcnt = a.vertex + L.vcnt + R.vcnt;
+        a.tree_sub = a.tree_here || (a.l && L.tree_sub) || (a.r && R.tree_sub);
+        a.nontree_sub = a.nontree_here || (a.l && L.nontree_sub) || (a.r && R.nontree_sub);
+        if (a.l) t[a.l].p = x;
+        if (a.r) t[a.r].p = x;
+    }
+
+    // Recomputes aggregates from x up to its root after a flag change.
+    void update_path(int x) {
+        while (x) {
+            pull(x);
+            x = t[x].p;
+        }
+    }
+
+    int merge(int a, int b) {
+        if (!a || !b) return a ? a : b;
+        if (t[a].pri > t[b].pri) {
+            t[a].r = merge(t[a].r, b);
+            pull(a);
+            return a;
+        }
+        t[b].l = merge(a, t[b].l);
+        pull(b);
+        return b;
+    }
+
+    int join(int a, int b) {
+        int root = merge(a, b);
+        t[root].p = 0;
+        return root;
+    }
+
+    // Splits off the first k nodes of the tour.
+    std::pair<int, int> split_rec(int x, int k) {
+        if (!x) return {0, 0};
+        if (t[t[x].l].cnt >= k) {
+            auto [a, b] = split_rec(t[x].l, k);
+            t[x].l = b;
+            pull(x);
+            return {a, x};
+        }
+        auto [a, b] = split_rec(t[x].r, k - t[t[x].l].cnt - 1);
+        t[x].r = a;
+        pull(x);
+        return {x, b};
+    }
+
+    std::pair<int, int> split(int x, int k) {
+        auto res = split_rec(x, k);
+        t[res.first].p = t[res.second].p = 0;
+        return res;
+    }
+
+    int root(int x) const {
+        while (t[x].p) x = t[x].p;
+        return x;
+    }
+
+    // Position of x in its tour.
+    int index(int x) const {
+        int k = t[t[x].l].cnt;
+        while (t[x].p) {
+            int p = t[x].p;
+            if (t[p].r == x) k += t[t[p].l].cnt + 1;
+            x = p;
+        }
+        return k;
+    }
+
+    // Rotates the tour so that it starts at x; returns the new root.
+    int reroot(int x) {
+        auto [a, b] = split(root(x), index(x));
+        return join(b, a);
+    }
+
+    int new_arc(int e) {
+        int x;
+        if (!free_nodes.empty()) {
+            x = free_nodes.back();
+            free_nodes.pop_back();
+            t[x] = Node();
+        } else {
+            x = t.size();
+            t.emplace_back();
+        }
+        t[x].pri = rng();
+        t[x].id = e;
+        pull(x);
+        return x;
+    }
+
+    // --- Euler tour forest operations ---
+
+    void link(int e, int level) {
+        Edge& ed = edges[e];
+        int a = new_arc(e), b = new_arc(e);
+        t[a].tree_here = ed.level == level;
+        pull(a);
+        int tu = reroot(vnode(level, ed.u));
+        int tv = reroot(vnode(level, ed.v));
+        join(join(join(tu, a), tv), b);
+        ed.arcs.push_back({a, b});
+    }
+
+    // Removes the two arcs of e from F_level, leaving two tours.
+    void cut(int e, int level) {
+        auto [a, b] = edges[e].arcs[level];
+        int ia = index(a), ib = index(b);
+        if (ia > ib) {
+            std::swap(a, b);
+            std::swap(ia, ib);
+        }
+        auto [left, rest] = split(root(a), ia);
+        auto [middle, right] = split(rest, ib - ia + 1);
+        join(left, right);
+        // Detach the two arcs at the ends of the middle part.
+        int inner = split(middle, 1).second;
+        split(inner, t[inner].cnt - 1);
+        free_nodes.push_back(a);
+        free_nodes.push_back(b);
+    }
+
+    // Finds any node in x's subtree with the given flag set, or 0.
+    int find_flag(int x, bool Node::*sub, bool Node::*here) const {
+        if (!x || !(t[x].*sub)) return 0;
+        while (!(t[x].*here)) {
+            x = (t[x].l && t[t[x].l].*sub) ? t[x].l : t[x].r;
+        }
+        return x;
+    }
+
+    // --- Non-tree edge lists ---
+
+    void add_nontree(int e, int level) {
+        Edge& ed = edges[e];
+        ed.level = level;
+        int ends[2] = {ed.u, ed.v};
+        for (int s = 0; s < 2; ++s) {
+            auto& list = nontree[level * (n + 1) + ends[s]];
+            ed.pos[s] = list.size();
+            list.push_back(e);
+            if (list.size() == 1) {
+                int x = vnode(level, ends[s]);
+                t[x].nontree_here = true;
+                update_path(x);
+            }
+        }
+    }
+
+    void remove_nontree(int e) {
+        Edge& ed = edges[e];
+        int ends[2] = {ed.u, ed.v};
+        for (int s = 0; s < 2; ++s) {
+            auto& list = nontree[ed.level * (n + 1) + ends[s]];
+            int moved = list.back();
+            list[ed.pos[s]] = moved;
+            edges[moved].pos[edges[moved].u == ends[s] ? 0 : 1] = ed.pos[s];
+            list.pop_back();
+            if (list.empty()) {
+                int x = vnode(ed.level, ends[s]);
+                t[x].nontree_here = false;
+                update_path(x);
+            }
+        }
+    }
+
+    // --- Public API ---
+
+    bool connected(int u, int v) const {
+        return root(vnode(0, u)) == root(vnode(0, v));
+    }
+
+    // Adds edge (u, v). Self-loops are ignored. A repeated (u, v) only adds a
+    // copy, like in DynamicConnectivity.cpp; the edge stays until every copy
+    // is removed.
+    void insert(int u, int v) {
+        if (u == v) return;
+        if (u > v) std::swap(u, v);
+        uint64_t key = (uint64_t)u << 32 | v;
+        auto it = edge_id.find(key);
+        if (it != edge_id.end()) {
+            edges[it->second].copies++;
+            return;
+        }
+
+        int e;
+        if (!free_edges.empty()) {
+            e = free_edges.back();
+            free_edges.pop_back();
+        } else {
+            e = edges.size();
+            edges.emplace_back();
+        }
+        edge_id[key] = e;
+        edges[e] = {u, v, 0, 1, false, {0, 0}, {}};
+
+        if (connected(u, v)) {
+            add_nontree(e, 0);
+        } else {
+            edges[e].tree = true;
+            link(e, 0);
+            components--;
+        }
+    }
+
+    // Removes one copy of edge (u, v) if present.
+    void erase(int u, int v) {
+        if (u > v) std::swap(u, v);
+        auto it = edge_id.find((uint64_t)u << 32 | v);
+        if (it == edge_id.end()) return;
+        int e = it->second;
+        if (--edges[e].copies > 0) return;
+        edge_id.erase(it);
+        free_edges.push_back(e);
+
+        if (!edges[e].tree) {
+            remove_nontree(e);
+            return;
+        }
+
+        int top = edges[e].level;
+        for (int i = 0; i <= top; ++i) {
+            cut(e, i);
+        }
+        edges[e].arcs.clear();
+
+        for (int i = top; i >= 0; --i) {
+            int ru = root(vnode(i, u)), rv = root(vnode(i, v));
+            int small = t[ru].vcnt <= t[rv].vcnt ? ru : rv;
+
+            // Push the smaller tree's level-i tree edges one level up. It has
+            // at most n / 2^(i+1) vertices, so it still fits in F_(i+1).
+            while (int x = find_flag(small, &Node::tree_sub, &Node::tree_here)) {
+                int f = t[x].id;
+                t[x].tree_here = false;
+                update_path(x);
+                edges[f].level = i + 1;
+                link(f, i + 1);
+            }
+
+            // Look for a level-i non-tree edge leaving the smaller tree.
+            while (int x = find_flag(small, &Node::nontree_sub, &Node::nontree_here)) {
+                int w = t[x].id;
+                auto& list = nontree[i * (n + 1) + w];
+                while (!list.empty()) {
+                    int f = list.back();
+                    int y = edges[f].u == w ? edges[f].v : edges[f].u;
+                    remove_nontree(f);
+                    if (root(vnode(i, y)) != small) {
+                        // Replacement found: it becomes a level-i tree edge.
+                        edges[f].tree = true;
+                        edges[f].level = i;
+                        for (int j = 0; j <= i; ++j) {
+                            link(f, j);
+                        }
+                        return;
+                    }
+                    // Both ends are in the smaller tree: raise it instead.
+                    add_nontree(f, i + 1);
+                }
+            }
+        }
+        // No replacement at any level: the tree really split.
+        components++;
+    }
+};
+
+#ifdef BENCHMARK
+// Compares HDT with recomputing the components from scratch (a DSU over the
+// current edge set) after every update, on a random mix of operations.
+void run_benchmark() {
+    const int n = 20000, ops = 200000;
+    std::mt19937 rng(777);
+    std::vector<std::pair<int, int>> current;
+    std::vector<std::pair<char, std::pair<int, int>>> log;
+    for (int k = 0; k < ops; ++k) {
+        if (current.empty() || rng() % 3 != 0) {
+            int u = rng() % n + 1, v = rng() % n + 1;
+            log.push_back({'+', {u, v}});
+            current.push_back({u, v});
+        } else {
+            int idx = rng() % current.size();
+            log.push_back({'-', current[idx]});
+            std::swap(current[idx], current.back());
+            current.pop_back();
+        }
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    HDT hdt(n);
+    std::vector<int> hdt_components(ops);
+    for (int k = 0; k < ops; ++k) {
+        auto [type, e] = log[k];
+        if (type == '+') hdt.insert(e.first, e.second);
+        else hdt.erase(e.first, e.second);
+        hdt_components[k] = hdt.components;
+    }
+    double hdt_secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    // Rebuilding is far slower, so it is only timed at every 100th update;
+    // the edge set itself is still tracked through the whole log.
+    const int stride = 100;
+    std::unordered_map<uint64_t, int> alive;
+    double rebuild_secs = 0;
+    int rebuilds = 0;
+    bool same = true;
+    for (int k = 0; k < ops; ++k) {
+        auto [type, e] = log[k];
+        int u = std::min(e.first, e.second), v = std::max(e.first, e.second);
+        if (u != v) {
+            uint64_t key = (uint64_t)u << 32 | v;
+            if (type == '+') {
+                alive[key]++;
+            } else {
+                auto it = alive.find(key);
+                if (it != alive.end() && --it->second == 0) alive.erase(it);
+            }
+        }
+        if (k % stride != 0) continue;
+
+        start = std::chrono::steady_clock::now();
+        std::vector<int> p(n + 1, -1);
+        int comps = n;
+        for (const auto& kv : alive) {
+            int a = kv.first >> 32, b = kv.first & 0xffffffffu;
+            while (p[a] >= 0) a = p[a];
+            while (p[b] >= 0) b = p[b];
+            if (a != b) {
+                if (p[a] > p[b]) std::swap(a, b);
+                p[a] += p[b];
+                p[b] = a;
+                comps--;
+            }
+        }
+        rebuild_secs += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        rebuilds++;
+        same = same && comps == hdt_components[k];
+    }
+
+    std::cout << "HDT: " << ops / hdt_secs << " updates/s\n";
+    std::cout << "rebuild: " << rebuilds / rebuild_secs << " updates/s"
+              << (same ? "" : " (MISMATCH)") << "\n";
+}
+#endif
+
+int main() {
+#ifdef BENCHMARK
+    run_benchmark();
+    return 0;
+#endif
+
+    // Fast I/O
+    std::ios_base::sync_with_stdio(false);
+    std::cin.tie(NULL);
+
+    // Operations, answered one at a time:
+    //   + u v  -> add edge (u, v)
+    //   - u v  -> remove one copy of edge (u, v)
+    //   c u v  -> print 1 if u and v are connected, 0 otherwise
+    //   ?      -> print the number of connected components
+    int n, q;
+    std::cin >> n >> q;
+    HDT hdt(n);
+    while (q--) {
+        char type;
+        std::cin >> type;
+        if (type == '?') {
+            std::cout << hdt.components << "\n";
+            continue;
+        }
+        int u, v;
+        std::cin >> u >> v;
+        if (type == '+') {
+            hdt.insert(u, v);
+        } else if (type == '-') {
+            hdt.erase(u, v);
+        } else {
+            std::cout << hdt.connected(u, v) << "\n";
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,96 @@
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <numeric>
+#include <tuple>
+#include "forestlca.h"
+
+// Kruskal reconstruction tree for all-pairs minimax (bottleneck) queries.
+// djkst() in dijkstramodified.cpp finds the smallest possible maximum edge
+// weight on a path from one source. That value is the heaviest edge on the
+// minimum spanning tree path, so it can be read off a single tree instead of
+// running a Dijkstra per source.
+//
+// Kruskal's algorithm is run as usual, but every merge of two components
+// creates a new node whose value is the merging edge's weight and whose
+// children are the two old component roots. The minimax distance between u
+// and v is then the value of their lowest common ancestor.
+// Build: O(m log m). Query: O(1) with the Euler tour LCA in forestlca.h.
+
+struct KruskalTree {
+    int n, nodes;
+    // Leaves are 1..n; internal nodes are n+1 .. nodes-1.
+    std::vector<long long> value;
+    CSRGraph tree;    // Each internal node joined to its two children
+    ForestLCA forest; // Rooted at the newest node of each tree
+
+    // Edges are (u, v, w) with 1-based endpoints.
+    KruskalTree(int n, std::vector<std::tuple<int, int, long long>> edges) : n(n) {
+        std::sort(edges.begin(), edges.end(), [](const auto& a, const auto& b) {
+            return std::get<2>(a) < std::get<2>(b);
+        });
+
+        value.assign(2 * n + 1, 0);
+        std::vector<std::pair<int, int>> children;
+        // DSU over tree nodes; the root of each set is its newest tree node.
+        std::vector<int> dsu(2 * n + 1);
+        std::iota(dsu.begin(), dsu.end(), 0);
+        auto find = [&](int x) {
+            while (dsu[x] != x) {
+                dsu[x] = dsu[dsu[x]];
+                x = dsu[x];
+            }
+            return x;
+        };
+
+        nodes = n + 1;
+        for (const auto& [u, v, w] : edges) {
+            int a = find(u), b = find(v);
+            if (a == b) continue;
+            int x = nodes++;
+            value[x] = w;
+            children.push_back({x, a});
+            children.push_back({x, b});
+            dsu[a] = dsu[b] = x;
+        }
+
+        std::vector<int> roots;
+        for (int r = 1; r < nodes; ++r) {
+            if (find(r) == r) roots.push_back(r);
+        }
+        tree = CSRGraph::from_edges(nodes, children, false);
+        forest = ForestLCA(tree, roots);
+    }
+
+    // Minimax distance between u and v, or -1 if they are not connected.
+    long long query(int u, int v) const {
+        if (u == v) return 0;
+        if (!forest.connected(u, v)) return -1;
+        return value[forest.lca(u, v)];
+    }
+};
+
+int main() {
+    // Fast I/O
+    std::ios_base::sync_with_stdio(false);
+    std::cin.tie(NULL);
+
+    int n, m;
+    std::cin >> n >> m; // N nodes (1-based), M undirected edges "u v w"
+    std::vector<std::tuple<int, int, long long>> edges(m);
+    for (auto& [u, v, w] : edges) {
+        std::cin >> u >> v >> w;
+    }
+
+    KruskalTree tree(n, edges);
+
+    int q;
+    std::cin >> q;
+    while (q--) {
+        int u, v;
+        std::cin >> u >> v;
+        std::cout << tree.query(u, v) << "\n";
+    }
+
+    return 0;
+}
@@ -3,6 +3,11 @@
 #include <cmath>
 #include <algorithm>
 #include <map>
+#include <cstdlib>
+#include <thread>
+#include <functional>
+#include <random>
+#include <chrono>
 
 using namespace std;
 
@@ -29,56 +34,174 @@ bool compare(const Query& a, const Query& b) {
 }
 
 // --- Frequency tracking data structures ---
-// freq[x]: stores the frequency of compressed number 'x'
-vector<int> freq;
-// freq_of_freq[k]: stores how many numbers have a frequency of 'k'
-vector<int> freq_of_freq;
-// The maximum frequency in the current window
-int max_freq;
-
-// --- Add/Remove functions for the sliding window ---
-
-// Adds an element at index 'idx' to the current window
-void add(int val) {
-    // Decrement the count for the old frequency
-    if (freq[val] > 0) {
+// All of the sliding-window state lives in one struct so that every worker
+// thread in parallel mode can own a private copy of it.
+struct Window {
+    // freq[x]: stores the frequency of compressed number 'x'
+    vector<int> freq;
+    // freq_of_freq[k]: stores how many numbers have a frequency of 'k'
+    vector<int> freq_of_freq;
+    // The maximum frequency in the current window
+    int max_freq;
+
+    Window(int num_values, int n) {
+        freq.assign(num_values + 1, 0);
+        freq_of_freq.assign(n + 2, 0); // Max possible frequency is N
+        max_freq = 0;
+    }
+
+    // --- Add/Remove functions for the sliding window ---
+
+    // Adds an element at index 'idx' to the current window
+    void add(int val) {
+        // Decrement the count for the old frequency
+        if (freq[val] > 0) {
+            freq_of_freq[freq[val]]--;
+        }
+
+        // Increment the frequency of the number
+        freq[val]++;
+
+        // Increment the count for the new frequency
+        freq_of_freq[freq[val]]++;
+
+        // Update max_freq if necessary
+        if (freq[val] > max_freq) {
+            max_freq = freq[val];
+        }
+    }
+
+    // Removes an element at index 'idx' from the current window
+    void remove(int val) {
+        // Decrement the count for the old frequency
         freq_of_freq[freq[val]]--;
+
+        // If we just removed the last number that had the max frequency,
+        // the new max frequency must be one less.
+        if (freq_of_freq[freq[val]] == 0 && freq[val] == max_freq) {
+            max_freq--;
+        }
+
+        // Decrement the frequency of the number
+        freq[val]--;
+
+        // Increment the count for the new frequency
+        if (freq[val] > 0) {
+            freq_of_freq[freq[val]]++;
+        }
     }
-    
-    // Increment the frequency of the number
-    freq[val]++;
-    
-    // Increment the count for the new frequency
-    freq_of_freq[freq[val]]++;
-    
-    // Update max_freq if necessary
-    if (freq[val] > max_freq) {
-        max_freq = freq[val];
+};
+
+// Answers the sorted queries in [begin, end) with a private window.
+// The first window is built directly by adding a[l..r] instead of walking
+// the pointers over from an empty window at index 0, which matters for
+// chunks that start deep inside the array.
+void solve_chunk(const vector<int>& a, const vector<Query>& queries, int begin, int end,
+                 int num_values, vector<pair<int, int>>& answers) {
+    if (begin >= end) return;
+
+    Window w(num_values, a.size());
+    int current_l = queries[begin].l;
+    int current_r = queries[begin].l - 1;
+
+    for (int i = begin; i < end; ++i) {
+        int l = queries[i].l;
+        int r = queries[i].r;
+
+        // Extend the window
+        while (current_l > l) {
+            current_l--;
+            w.add(a[current_l]);
+        }
+        while (current_r < r) {
+            current_r++;
+            w.add(a[current_r]);
+        }
+
+        // Shrink the window
+        while (current_l < l) {
+            w.remove(a[current_l]);
+            current_l++;
+        }
+        while (current_r > r) {
+            w.remove(a[current_r]);
+            current_r--;
+        }
+
+        // Store the answer for the current query. Every query id belongs to
+        // exactly one chunk, so workers never write the same slot.
+        answers[queries[i].id] = {w.max_freq, w.freq_of_freq[w.max_freq]};
     }
 }
 
-// Removes an element at index 'idx' from the current window
-void remove(int val) {
-    // Decrement the count for the old frequency
-    freq_of_freq[freq[val]]--;
-    
-    // If we just removed the last number that had the max frequency,
-    // the new max frequency must be one less.
-    if (freq_of_freq[freq[val]] == 0 && freq[val] == max_freq) {
-        max_freq--;
-    }
-    
-    // Decrement the frequency of the number
-    freq[val]--;
-    
-    // Increment the count for the new frequency
-    if (freq[val] > 0) {
-        freq_of_freq[freq[val]]++;
+// Splits the sorted query list into 'num_threads' contiguous chunks and
+// answers each chunk on its own thread. Chunks are cut on query count, so
+// the per-thread pointer movement stays roughly balanced.
+void solve(const vector<int>& a, const vector<Query>& queries, int num_values,
+           int num_threads, vector<pair<int, int>>& answers) {
+    int q = queries.size();
+    num_threads = max(1, min(num_threads, q));
+    if (num_threads == 1) {
+        solve_chunk(a, queries, 0, q, num_values, answers);
+        return;
+    }
+
+    vector<thread> workers;
+    for (int t = 0; t < num_threads; ++t) {
+        int begin = (long long)q * t / num_threads;
+        int end = (long long)q * (t + 1) / num_threads;
+        workers.emplace_back(solve_chunk, cref(a), cref(queries), begin, end,
+                             num_values, ref(answers));
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
+
+#ifdef BENCHMARK
+// Times the query loop on a random instance at several thread counts and
+// reports the speedup over the single-threaded run.
+void run_benchmark() {
+    const int n = 300000, q = 300000, num_values = 1000;
+    mt19937 rng(12345);
+    vector<int> a(n);
+    for (int i = 0; i < n; ++i) {
+        a[i] = rng() % num_values;
+    }
+    vector<Query> queries(q);
+    for (int i = 0; i < q; ++i) {
+        int l = rng() % n, r = rng() % n;
+        if (l > r) swap(l, r);
+        queries[i] = {l, r, i};
+    }
+    BLOCK_SIZE = max(1, (int)sqrt(n));
+    sort(queries.begin(), queries.end(), compare);
+
+    vector<pair<int, int>> answers(q), reference(q);
+    double base = 0;
+    for (int threads : {1, 4, 8, 16}) {
+        // Clear the previous run's answers so a slot left unwritten shows up as a mismatch
+        answers.assign(q, {-1, -1});
+        auto start = chrono::steady_clock::now();
+        solve(a, queries, num_values, threads, threads == 1 ? reference : answers);
+        double secs = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+        if (threads == 1) base = secs;
+        bool same = threads == 1 || answers == reference;
+        cout << threads << " threads: " << secs << " s, speedup " << base / secs
+             << (same ? "" : " (MISMATCH)") << "\n";
     }
 }
+#endif
 
 
-int main() {
+// Usage: ./mo [threads]   (defaults to a single thread)
+int main(int argc, char* argv[]) {
+#ifdef BENCHMARK
+    run_benchmark();
+    return 0;
+#endif
+    int num_threads = argc > 1 ? atoi(argv[1]) : 1;
+
     // Fast I/O
     ios_base::sync_with_stdio(false);
     cin.tie(NULL);
@@ -117,44 +240,11 @@ int main() {
     }
 
     // --- Mo's Algorithm ---
-    BLOCK_SIZE = sqrt(n);
+    BLOCK_SIZE = max(1, (int)sqrt(n));
     sort(queries.begin(), queries.end(), compare);
 
     vector<pair<int, int>> answers(q);
-    freq.assign(compressed_value + 1, 0);
-    freq_of_freq.assign(n + 2, 0); // Max possible frequency is N
-    max_freq = 0;
-    
-    int current_l = 0;
-    int current_r = -1;
-
-    for (const auto& query : queries) {
-        int l = query.l;
-        int r = query.r;
-
-        // Extend the window
-        while (current_l > l) {
-            current_l--;
-            add(a[current_l]);
-        }
-        while (current_r < r) {
-            current_r++;
-            add(a[current_r]);
-        }
-        
-        // Shrink the window
-        while (current_l < l) {
-            remove(a[current_l]);
-            current_l++;
-        }
-        while (current_r > r) {
-            remove(a[current_r]);
-            current_r--;
-        }
-        
-        // Store the answer for the current query
-        answers[query.id] = {max_freq, freq_of_freq[max_freq]};
-    }
+    solve(a, queries, compressed_value, num_threads, answers);
 
     // --- Output ---
     for (int i = 0; i < q; ++i) {
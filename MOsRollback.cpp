@@ -0,0 +1,170 @@
+#include <iostream>
+#include <vector>
+#include <cmath>
+#include <algorithm>
+#include <map>
+
+using namespace std;
+
+// Mo's algorithm with rollback ("add-only" Mo).
+// Answers the same queries as MOsAlgorithm.cpp (maximum frequency in a[l..r]
+// and how many values reach it), but the window only ever adds elements.
+// Removals are replaced by restoring a snapshot through an undo log, so any
+// aggregate with an O(1) add works here even if it has no cheap remove
+// (max, max-gap, top-k frequency, ...). Total cost is O((n + q) * sqrt(n)).
+
+// --- Global variables ---
+int BLOCK_SIZE;
+
+// A struct to hold query information: Left, Right, and original index.
+struct Query {
+    int l, r, id;
+};
+
+// Queries are grouped by the block of 'l' and sorted by 'r' ascending inside
+// a block, so the right pointer only moves forward within a block.
+bool compare(const Query& a, const Query& b) {
+    int block_a = a.l / BLOCK_SIZE;
+    int block_b = b.l / BLOCK_SIZE;
+    if (block_a != block_b) {
+        return block_a < block_b;
+    }
+    return a.r < b.r;
+}
+
+// The add-only window. Every add() records the touched value in 'history',
+// and rollback() pops the history back to a snapshot.
+struct Window {
+    // freq[x]: stores the frequency of compressed number 'x'
+    vector<int> freq;
+    // The maximum frequency in the current window, and how many values have it
+    int max_freq, max_count;
+    // Values added since the window was empty, in order
+    vector<int> history;
+
+    struct Snapshot {
+        size_t history_size;
+        int max_freq, max_count;
+    };
+
+    Window(int num_values) {
+        freq.assign(num_values + 1, 0);
+        max_freq = max_count = 0;
+    }
+
+    void add(int val) {
+        history.push_back(val);
+        freq[val]++;
+        if (freq[val] > max_freq) {
+            max_freq = freq[val];
+            max_count = 1;
+        } else if (freq[val] == max_freq) {
+            max_count++;
+        }
+    }
+
+    Snapshot snapshot() const {
+        return {history.size(), max_freq, max_count};
+    }
+
+    // Undoes every add() made after 's' was taken.
+    void rollback(const Snapshot& s) {
+        while (history.size() > s.history_size) {
+            freq[history.back()]--;
+            history.pop_back();
+        }
+        max_freq = s.max_freq;
+        max_count = s.max_count;
+    }
+};
+
+int main() {
+    // Fast I/O
+    ios_base::sync_with_stdio(false);
+    cin.tie(NULL);
+
+    int n, q;
+    cin >> n >> q;
+
+    vector<int> a(n);
+    map<int, int> compression_map;
+    int compressed_value = 0;
+
+    // --- Coordinate Compression ---
+    for (int i = 0; i < n; ++i) {
+        cin >> a[i];
+        compression_map[a[i]] = 0;
+    }
+    for (auto const& [val, placeholder] : compression_map) {
+        compression_map[val] = compressed_value++;
+    }
+    for (int i = 0; i < n; ++i) {
+        a[i] = compression_map[a[i]];
+    }
+
+    // --- Query Processing ---
+    vector<Query> queries(q);
+    for (int i = 0; i < q; ++i) {
+        cin >> queries[i].l >> queries[i].r;
+        queries[i].l--; // Convert to 0-based index
+        queries[i].r--; // Convert to 0-based index
+        queries[i].id = i;
+    }
+
+    BLOCK_SIZE = max(1, (int)sqrt(n));
+    sort(queries.begin(), queries.end(), compare);
+
+    vector<pair<int, int>> answers(q);
+    Window w(compressed_value);
+    const Window::Snapshot empty = w.snapshot();
+
+    int i = 0;
+    while (i < q) {
+        int block = queries[i].l / BLOCK_SIZE;
+        // First index of the next block: the right part of every query in
+        // this block grows from here.
+        int block_end = min(n, (block + 1) * BLOCK_SIZE);
+        int current_r = block_end - 1;
+
+        for (; i < q && queries[i].l / BLOCK_SIZE == block; ++i) {
+            const Query& query = queries[i];
+
+            if (query.r < block_end) {
+                // Short query inside a single block: add it from scratch and
+                // throw it away again. At most BLOCK_SIZE steps.
+                Window::Snapshot s = w.snapshot();
+                for (int j = query.l; j <= query.r; ++j) {
+                    w.add(a[j]);
+                }
+                answers[query.id] = {w.max_freq, w.max_count};
+                w.rollback(s);
+                continue;
+            }
+
+            // The right part [block_end, r] only grows within a block.
+            while (current_r < query.r) {
+                current_r++;
+                w.add(a[current_r]);
+            }
+
+            // The left part [l, block_end) is added on top and undone.
+            Window::Snapshot s = w.snapshot();
+            for (int j = query.l; j < block_end; ++j) {
+                w.add(a[j]);
+            }
+            answers[query.id] = {w.max_freq, w.max_count};
+            w.rollback(s);
+        }
+
+        // Clear the right part before the next block. Going through the undo
+        // log costs only what was added, not the size of the value domain.
+        w.rollback(empty);
+    }
+
+    // --- Output ---
+    for (int k = 0; k < q; ++k) {
+        cout << answers[k].first << " " << answers[k].second << "\n";
+    }
+
+    return 0;
+}
@@ -0,0 +1,370 @@
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <cstdint>
+#include <cstdlib>
+#include <chrono>
+#include <random>
+#include "threadpool.h"
+#include "csrgraph.h"
+#include "concurrentdsu.h"
+#include "lowlink.h"
+
+// Parallel bridges and articulation points (Tarjan-Vishkin).
+// The lowlink DFS in lowlink.h needs a depth-first tree, which cannot be
+// built in parallel. Tarjan-Vishkin works on any spanning tree:
+//   1. A parallel BFS builds a spanning forest. Each frontier is split over the
+//      threads in order, so the children of every vertex end up contiguous in
+//      the next level, and a prefix sum over the child counts gives each vertex
+//      its range of children (a CSR tree with no sorting).
+//   2. Bottom-up over the levels: subtree sizes. Top-down: preorder numbers,
+//      each child starting after the subtrees of its earlier siblings.
+//   3. low(v) / high(v): the smallest / largest preorder number reachable from
+//      v's subtree by one non-tree edge (or the subtree itself), bottom-up again.
+//   4. The tree edge above v is a bridge iff nothing leaves v's subtree:
+//      low(v) >= pre(v) and high(v) < pre(v) + size(v).
+//   5. Biconnected components are the connected components of an auxiliary
+//      graph on the tree edges (tree edge "v" = the edge from v to its parent):
+//      - a non-tree edge (u, w) between unrelated vertices joins u and w;
+//      - a tree edge w below a non-root v joins v if w's subtree reaches
+//        outside v's subtree: low(w) < pre(v) or high(w) >= pre(v) + size(v).
+//      These are joined with the lock-free DSU from UnionFind.cpp. A vertex is
+//      an articulation point iff its incident tree edges are not all in one
+//      component (non-tree edges always share a component with one of them).
+// Every pass is O(n + m) work split over a thread pool; levels that are too
+// small to be worth waking the pool are done inline.
+// Edges are matched by id, so a doubled edge is never a bridge, as in lowlink.h.
+
+// Exclusive prefix sum of a[begin .. end) in place, returning the total:
+// each thread sums its block, the block sums are scanned, then each thread
+// rescans its block from its offset.
+long long exclusive_scan(ThreadPool& pool, std::vector<int>& a, long long begin, long long end) {
+    long long n = end - begin;
+    int parts = n < ThreadPool::GRAIN ? 1 : pool.num_threads;
+    std::vector<long long> block(parts + 1, 0);
+    pool.parallel_for(n, [&](int t, long long b, long long e) {
+        long long s = 0;
+        for (long long i = b; i < e; ++i) s += a[begin + i];
+        block[t + 1] = s;
+    });
+    for (int t = 0; t < parts; ++t) block[t + 1] += block[t];
+    pool.parallel_for(n, [&](int t, long long b, long long e) {
+        long long s = block[t];
+        for (long long i = b; i < e; ++i) {
+            long long x = a[begin + i];
+            a[begin + i] = s;
+            s += x;
+        }
+    });
+    return block[parts];
+}
+
+struct ParallelBridges {
+    const CSRGraph& g; // Undirected, built with edge ids
+    int n;
+    ThreadPool& pool;
+
+    // Spanning forest in BFS order. order[] lists the vertices level by level
+    // (one component after another); level i is order[level_begin[i] ..
+    // level_begin[i+1]). The children of order[p] are order[child_begin[p] ..
+    // child_end[p]).
+    std::vector<int> order, level_begin, child_begin, child_end;
+    std::vector<int> parent, parent_edge; // -1 at the roots
+    std::vector<int> size, pre, low, high;
+
+    // --- Results ---
+    std::vector<int> bridges;            // Edge ids, sorted
+    std::vector<char> is_articulation;
+
+    ParallelBridges(const CSRGraph& g, ThreadPool& pool) : g(g), n(g.n), pool(pool) {
+        build_forest();
+        number_subtrees();
+        find_low_high();
+        find_bridges();
+        find_articulation_points();
+    }
+
+    void build_forest() {
+        std::vector<std::atomic<int>> claimed(n);
+        pool.parallel_for(n, [&](int, long long b, long long e) {
+            for (long long v = b; v < e; ++v) claimed[v].store(-1, std::memory_order_relaxed);
+        });
+        parent.assign(n, -1);
+        parent_edge.assign(n, -1);
+        order.assign(n, 0);
+        child_begin.assign(n, 0);
+        child_end.assign(n, 0);
+        level_begin.assign(1, 0);
+        std::vector<std::vector<int>> next(pool.num_threads);
+        std::vector<long long> next_offset(pool.num_threads + 1);
+
+        int placed = 0;
+        for (int root = 0; root < n; ++root) {
+            if (claimed[root].load(std::memory_order_relaxed) != -1) continue;
+            claimed[root].store(root, std::memory_order_relaxed);
+            order[placed++] = root;
+            level_begin.push_back(placed);
+
+            while (level_begin.back() > level_begin[level_begin.size() - 2]) {
+                int lb = level_begin[level_begin.size() - 2], le = level_begin.back();
+                int parts = le - lb < ThreadPool::GRAIN ? 1 : pool.num_threads;
+                // Each part claims the unvisited neighbours of its slice of the
+                // frontier, in order, and counts them per frontier vertex.
+                pool.parallel_for(le - lb, [&](int t, long long b, long long e) {
+                    next[t].clear();
+                    for (long long i = lb + b; i < lb + e; ++i) {
+                        int u = order[i], found = 0;
+                        for (uint64_t a = g.offset[u]; a < g.offset[u + 1]; ++a) {
+                            int v = g.to[a], expected = -1;
+                            if (claimed[v].load(std::memory_order_relaxed) == -1 &&
+                                claimed[v].compare_exchange_strong(expected, u, std::memory_order_relaxed)) {
+                                parent[v] = u;
+                                parent_edge[v] = g.id[a];
+                                next[t].push_back(v);
+                                found++;
+                            }
+                        }
+                        child_begin[i] = child_end[i] = found;
+                    }
+                });
+                // Child ranges are the prefix sums of the counts, starting at
+                // the end of this level.
+                int total = exclusive_scan(pool, child_begin, lb, le);
+                pool.parallel_for(le - lb, [&](int, long long b, long long e) {
+                    for (long long i = lb + b; i < lb + e; ++i) {
+                        child_begin[i] += le;
+                        child_end[i] += child_begin[i];
+                    }
+                });
+                next_offset[0] = le;
+                for (int t = 0; t < parts; ++t) next_offset[t + 1] = next_offset[t] + next[t].size();
+                pool.parallel_for(le - lb, [&](int t, long long, long long) {
+                    std::copy(next[t].begin(), next[t].end(), order.begin() + next_offset[t]);
+                });
+                placed += total;
+                level_begin.push_back(placed);
+            }
+            level_begin.pop_back(); // the empty level below the deepest one
+        }
+    }
+
+    // Runs f(p) for every position p of level i.
+    template <typename F>
+    void for_level(int i, F f) {
+        int lb = level_begin[i], le = level_begin[i + 1];
+        pool.parallel_for(le - lb, [&](int, long long b, long long e) {
+            for (long long p = lb + b; p < lb + e; ++p) f(p);
+        });
+    }
+
+    void number_subtrees() {
+        size.assign(n, 1);
+        pre.assign(n, 0);
+        int levels = level_begin.size() - 1;
+        for (int i = levels - 1; i >= 0; --i) {
+            for_level(i, [&](int p) {
+                int v = order[p];
+                for (int c = child_begin[p]; c < child_end[p]; ++c) size[v] += size[order[c]];
+            });
+        }
+        // Each component occupies a contiguous run of order[], so its root can
+        // take the first position of that run as its preorder number.
+        for (int i = 0; i < levels; ++i) {
+            for_level(i, [&](int p) {
+                int v = order[p];
+                if (parent[v] == -1) pre[v] = p;
+                int next = pre[v] + 1;
+                for (int c = child_begin[p]; c < child_end[p]; ++c) {
+                    pre[order[c]] = next;
+                    next += size[order[c]];
+                }
+            });
+        }
+    }
+
+    void find_low_high() {
+        low.assign(n, 0);
+        high.assign(n, 0);
+        pool.parallel_for(n, [&](int, long long b, long long e) {
+            for (long long v = b; v < e; ++v) {
+                int lo = pre[v], hi = pre[v];
+                for (uint64_t a = g.offset[v]; a < g.offset[v + 1]; ++a) {
+                    if ((int)g.id[a] == parent_edge[v]) continue;
+                    lo = std::min(lo, pre[g.to[a]]);
+                    hi = std::max(hi, pre[g.to[a]]);
+                }
+                low[v] = lo;
+                high[v] = hi;
+            }
+        });
+        for (int i = (int)level_begin.size() - 2; i >= 0; --i) {
+            for_level(i, [&](int p) {
+                int v = order[p];
+                for (int c = child_begin[p]; c < child_end[p]; ++c) {
+                    low[v] = std::min(low[v], low[order[c]]);
+                    high[v] = std::max(high[v], high[order[c]]);
+                }
+            });
+        }
+    }
+
+    void find_bridges() {
+        std::vector<std::vector<int>> found(pool.num_threads);
+        pool.parallel_for(n, [&](int t, long long b, long long e) {
+            found[t].clear();
+            for (long long v = b; v < e; ++v) {
+                if (parent[v] != -1 && low[v] >= pre[v] && high[v] < pre[v] + size[v]) {
+                    found[t].push_back(parent_edge[v]);
+                }
+            }
+        });
+        for (const auto& f : found) bridges.insert(bridges.end(), f.begin(), f.end());
+        std::sort(bridges.begin(), bridges.end());
+    }
+
+    void find_articulation_points() {
+        ConcurrentDSU dsu(n);
+        auto ancestor = [&](int a, int b) { // Is a an ancestor of b (or b itself)?
+            return pre[a] <= pre[b] && pre[b] < pre[a] + size[a];
+        };
+        pool.parallel_for(n, [&](int, long long b, long long e) {
+            for (long long u = b; u < e; ++u) {
+                // Non-tree edges between unrelated vertices, seen from the end
+                // with the larger preorder number
+                for (uint64_t a = g.offset[u]; a < g.offset[u + 1]; ++a) {
+                    int w = g.to[a];
+                    if (pre[w] < pre[u] && !ancestor(w, u)) dsu.unite(u, w);
+                }
+                // Tree edge u below a non-root v whose subtree u's subtree escapes
+                int v = parent[u];
+                if (v != -1 && parent[v] != -1 &&
+                    (low[u] < pre[v] || high[u] >= pre[v] + size[v])) {
+                    dsu.unite(u, v);
+                }
+            }
+        });
+
+        is_articulation.assign(n, 0);
+        pool.parallel_for(n, [&](int, long long b, long long e) {
+            for (long long p = b; p < e; ++p) {
+                int v = order[p], first = child_begin[p], last = child_end[p];
+                if (first == last) continue;
+                // Compare every child edge with the edge above v, or for a
+                // root with its first child edge
+                int block = dsu.find(parent[v] != -1 ? v : order[first]);
+                for (int c = first; c < last; ++c) {
+                    if (dsu.find(order[c]) != block) {
+                        is_articulation[v] = 1;
+                        break;
+                    }
+                }
+            }
+        });
+    }
+};
+
+#ifdef BENCHMARK
+// Times the parallel version against the sequential lowlink pass on a random
+// graph with pendant trees and cycles hung off it (so there are plenty of
+// bridges and articulation points), and checks that the results match.
+void run_benchmark() {
+    const int core = 4000000, extra = 4000000;
+    const long long core_edges = 40000000;
+    std::mt19937 rng(46);
+    std::vector<std::pair<int, int>> edges;
+    edges.reserve(core_edges + 2 * extra);
+    for (long long i = 0; i < core_edges; ++i) {
+        edges.push_back({(int)(rng() % core), (int)(rng() % core)});
+    }
+    for (int v = core; v < core + extra; ++v) {
+        edges.push_back({v, (int)(rng() % v)});
+        if (rng() % 4 == 0) edges.push_back({v, (int)(rng() % v)});
+    }
+    CSRGraph g = CSRGraph::from_edges(core + extra, edges, false, true);
+
+    // Sequential reference: the lowlink engine from lowlink.h. It also
+    // collects biconnected and 2-edge-connected components on the way.
+    auto start = std::chrono::steady_clock::now();
+    Lowlink lowlink(g);
+    std::vector<int> seq_bridges = lowlink.bridges;
+    std::sort(seq_bridges.begin(), seq_bridges.end());
+    const std::vector<char>& seq_aps = lowlink.is_articulation;
+    double sequential = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::cout << "sequential lowlink: " << sequential << " s, " << seq_bridges.size() << " bridges\n";
+
+    for (int threads : {1, 2, 4, 8, 16, 32, 64}) {
+        ThreadPool pool(threads);
+        start = std::chrono::steady_clock::now();
+        ParallelBridges pb(g, pool);
+        double secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        bool same = pb.bridges == seq_bridges && pb.is_articulation == seq_aps;
+        std::cout << "tarjan-vishkin " << threads << " threads: " << secs << " s, speedup over sequential "
+                  << sequential / secs << (same ? "" : " (MISMATCH)") << "\n";
+    }
+}
+#endif
+
+// Usage: ./parallelbridges [threads] [edge file]
+// Threads default to all hardware threads. Without an edge file the graph is
+// read from stdin as "V E" and E lines "u v" (0-based).
+int main(int argc, char* argv[]) {
+#ifdef BENCHMARK
+    run_benchmark();
+    return 0;
+#endif
+    int num_threads = argc > 1 ? std::atoi(argv[1]) : std::thread::hardware_concurrency();
+    num_threads = std::max(1, num_threads);
+
+    // Fast I/O
+    std::ios_base::sync_with_stdio(false);
+    std::cin.tie(NULL);
+
+    CSRGraph g;
+    if (argc > 2) {
+        g = CSRGraph::from_edge_file(argv[2], false, true);
+    } else {
+        int V, E;
+        std::cin >> V >> E;
+        std::vector<std::pair<int, int>> edges(E);
+        for (auto& e : edges) {
+            std::cin >> e.first >> e.second;
+        }
+        g = CSRGraph::from_edges(V, edges, false, true);
+    }
+
+    ThreadPool pool(num_threads);
+    ParallelBridges pb(g, pool);
+
+    // A bridge is a tree edge, so its endpoints are a vertex and its parent
+    std::vector<std::pair<int, int>> found; // (edge id, child endpoint)
+    for (int v = 0; v < (int)g.n; ++v) {
+        if (pb.parent[v] != -1 && std::binary_search(pb.bridges.begin(), pb.bridges.end(), pb.parent_edge[v])) {
+            found.push_back({pb.parent_edge[v], v});
+        }
+    }
+    std::sort(found.begin(), found.end());
+
+    std::cout << "Bridges are:\n";
+    if (found.empty()) {
+        std::cout << "None\n";
+    }
+    for (const auto& f : found) {
+        int v = f.second;
+        int a = std::min(pb.parent[v], v), b = std::max(pb.parent[v], v);
+        std::cout << a << " - " << b << "\n";
+    }
+
+    std::cout << "\nArticulation Points are:\n";
+    bool any = false;
+    for (int v = 0; v < (int)g.n; ++v) {
+        if (pb.is_articulation[v]) {
+            std::cout << v << " ";
+            any = true;
+        }
+    }
+    std::cout << (any ? "\n" : "None\n");
+
+    return 0;
+}
\ No newline at end of file
@@ -1,46 +1,152 @@
-vector<int> disc, low, parent;
-vector<pair<int, int> > bridges;
-int timer;
-
-void find_bridges_dfs(int u, const vector<vector<ll> >& adj) {
-    disc[u] = low[u] = timer++;
-    
-    for (ll v_ll : adj[u]) {
-        int v = static_cast<int>(v_ll);
-        
-        if (v == parent[u]) {
-            continue;
-        }
-
-        if (disc[v] != -1) {
-            low[u] = min(low[u], disc[v]);
-        } 
-        else {
-            parent[v] = u;
-            find_bridges_dfs(v, adj);
-            
-            low[u] = min(low[u], low[v]);
-            
-          
-            if (low[v] > disc[u]) {
-                bridges.push_back(make_pair(u, v));
+#include "lowlink.h"
+
+// Bridges of an undirected graph with vertices 1..n, as (parent, child) pairs
+// of the DFS tree. adj lists every edge from both ends. The edges are handed
+// to the iterative lowlink engine (lowlink.h) with edge ids, so long paths
+// cannot overflow the call stack and a doubled edge is never a bridge.
+vector<pair<int, int> > findBridges(int n, const vector<vector<ll> >& adj) {
+    vector<pair<int, int> > edges;
+    for (int u = 1; u <= n; ++u) {
+        for (ll v : adj[u]) {
+            // Keep each edge once, from its smaller end; self-loops never matter
+            if (u < v) {
+                edges.push_back(make_pair(u, (int)v));
             }
         }
     }
+    CSRGraph g = CSRGraph::from_edges(n + 1, edges, false, true);
+    Lowlink lowlink(g);
+    return lowlink.bridge_ends;
 }
 
+// Incremental bridges: keeps the number of bridges up to date while edges are
+// only ever added, instead of calling findBridges() again after each one.
+// The 2-edge-connected components are kept in one DSU (dsu_2ecc) and
+// contracted into a bridge forest. par[] links each component representative
+// to its parent in the forest. A second DSU (dsu_cc) tracks which tree a
+// component is in, with its size at the root.
+//   - An edge inside one component changes nothing.
+//   - An edge between two trees is a new bridge. The smaller tree is rerooted
+//     at its endpoint and hung below the other endpoint.
+//   - An edge inside one tree closes a cycle. Every forest edge on the path
+//     between its endpoints stops being a bridge, and the path merges into one
+//     component.
+// Rerooting the smaller side gives O(log n) amortized per insertion on top of
+// the DSU cost. Vertices are 1..n like findBridges(); parallel edges count.
+struct IncrementalBridges {
+    vector<int> par, dsu_2ecc, dsu_cc, dsu_cc_size, last_visit;
+    vector<int> path_a, path_b;
+    int bridge_count, lca_iteration;
 
-vector<pair<int, int> > findBridges(int n, const vector<vector<ll> >& adj) {
-    disc.assign(n + 1, -1);
-    low.assign(n + 1, -1);
-    parent.assign(n + 1, -1);
-    bridges.clear();
-    timer = 0;
+    IncrementalBridges(int n)
+        : par(n + 1, -1), dsu_2ecc(n + 1), dsu_cc(n + 1), dsu_cc_size(n + 1, 1),
+          last_visit(n + 1, 0), bridge_count(0), lca_iteration(0) {
+        for (int i = 0; i <= n; ++i) {
+            dsu_2ecc[i] = i;
+            dsu_cc[i] = i;
+        }
+    }
+
+    int find_2ecc(int v) {
+        if (v == -1) return -1;
+        while (dsu_2ecc[v] != v) {
+            dsu_2ecc[v] = dsu_2ecc[dsu_2ecc[v]];
+            v = dsu_2ecc[v];
+        }
+        return v;
+    }
+
+    // dsu_cc links may point at vertices whose component has since been
+    // merged, so every step goes through find_2ecc().
+    int find_cc(int v) {
+        v = find_2ecc(v);
+        int root = v;
+        while (dsu_cc[root] != root) root = find_2ecc(dsu_cc[root]);
+        while (v != root) {
+            int next = find_2ecc(dsu_cc[v]);
+            dsu_cc[v] = root;
+            v = next;
+        }
+        return root;
+    }
+
+    // Makes component v the root of its tree by reversing the parent links
+    // on the path from v to the old root.
+    void make_root(int v) {
+        int root = v, child = -1;
+        while (v != -1) {
+            int p = find_2ecc(par[v]);
+            par[v] = child;
+            dsu_cc[v] = root;
+            child = v;
+            v = p;
+        }
+        dsu_cc_size[root] = dsu_cc_size[child];
+    }
 
-    for (int i = 1; i <= n; ++i) {
-        if (disc[i] == -1) {
-            find_bridges_dfs(i, adj);
+    // Walks up from a and b in lockstep until the paths meet, then merges
+    // both paths into the component at the meeting point.
+    void merge_path(int a, int b) {
+        ++lca_iteration;
+        path_a.clear();
+        path_b.clear();
+        int lca = -1;
+        while (lca == -1) {
+            if (a != -1) {
+                a = find_2ecc(a);
+                path_a.push_back(a);
+                if (last_visit[a] == lca_iteration) {
+                    lca = a;
+                    break;
+                }
+                last_visit[a] = lca_iteration;
+                a = par[a];
+            }
+            if (b != -1) {
+                b = find_2ecc(b);
+                path_b.push_back(b);
+                if (last_visit[b] == lca_iteration) {
+                    lca = b;
+                    break;
+                }
+                last_visit[b] = lca_iteration;
+                b = par[b];
+            }
         }
+
+        for (int v : path_a) {
+            dsu_2ecc[v] = lca;
+            if (v == lca) break;
+            --bridge_count;
+        }
+        for (int v : path_b) {
+            dsu_2ecc[v] = lca;
+            if (v == lca) break;
+            --bridge_count;
+        }
+    }
+
+    void add_edge(int a, int b) {
+        a = find_2ecc(a);
+        b = find_2ecc(b);
+        if (a == b) return;
+
+        int ca = find_cc(a), cb = find_cc(b);
+        if (ca != cb) {
+            ++bridge_count;
+            if (dsu_cc_size[ca] > dsu_cc_size[cb]) {
+                swap(a, b);
+                swap(ca, cb);
+            }
+            make_root(a);
+            par[a] = dsu_cc[a] = b;
+            dsu_cc_size[cb] += dsu_cc_size[a];
+        } else {
+            merge_path(a, b);
+        }
+    }
+
+    bool two_edge_connected(int u, int v) {
+        return find_2ecc(u) == find_2ecc(v);
     }
-    return bridges;
-}
\ No newline at end of file
+};
\ No newline at end of file
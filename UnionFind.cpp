@@ -2,54 +2,200 @@
 #include <vector>
 #include <numeric>
 #include <algorithm>
+#include <cstdint>
+#include <chrono>
+#include <random>
+#include <string>
+#include <atomic>
+#include <thread>
+#include <cstdlib>
+#include "concurrentdsu.h"
 
 // A structure to represent the Disjoint Set Union (DSU) or Union-Find data structure.
+// Parent links and set sizes share one packed array: p[i] >= 0 is the parent
+// of i, and p[i] < 0 marks a root whose set has -p[i] elements.
 struct DSU {
-    // parent[i] stores the parent of element i.
-    std::vector<int> parent;
-    // size[i] stores the size of the set that element i belongs to.
-    std::vector<int> sz;
+    std::vector<int32_t> p;
     // The number of disjoint sets or connected components.
     int components;
 
     // Constructor to initialize the DSU structure for 'n' elements.
-    // Each element is initially in its own set.
+    // Each element is initially in its own set of size 1.
     DSU(int n) {
+        p.assign(n + 1, -1);
+        components = n;
+    }
+
+    // Finds the representative (or root) of the set containing element 'i'.
+    // Iterative with path halving: every other node on the path is pointed at
+    // its grandparent, so long chains never touch the call stack.
+    int find(int i) {
+        while (p[i] >= 0) {
+            if (p[p[i]] >= 0) {
+                p[i] = p[p[i]];
+            }
+            i = p[i];
+        }
+        return i;
+    }
+
+    // Size of the set containing element 'i'.
+    int size(int i) {
+        return -p[find(i)];
+    }
+
+    // Merges the sets containing elements 'i' and 'j' with union by size.
+    void unite(int i, int j) {
+        int root_i = find(i);
+        int root_j = find(j);
+        // If they are not already in the same set, merge them.
+        if (root_i != root_j) {
+            // Union by size: attach the smaller tree to the root of the larger tree.
+            if (p[root_i] > p[root_j]) {
+                std::swap(root_i, root_j);
+            }
+            p[root_i] += p[root_j];
+            p[root_j] = root_i;
+            // Merging two components reduces the total number of components by one.
+            components--;
+        }
+    }
+};
+
+// Unites every edge e[i] with keep(i) true, split across 'num_threads' threads
+// in interleaved stripes of 4096 edges.
+template <typename Keep>
+void parallel_unite(ConcurrentDSU& dsu, const std::vector<std::pair<int, int>>& edges,
+                    Keep keep, int num_threads) {
+    const int stripe = 4096;
+    int m = edges.size();
+    auto worker = [&](int t) {
+        for (int begin = t * stripe; begin < m; begin += num_threads * stripe) {
+            int end = std::min(m, begin + stripe);
+            for (int i = begin; i < end; ++i) {
+                if (keep(i)) {
+                    dsu.unite(edges[i].first, edges[i].second);
+                }
+            }
+        }
+    };
+    std::vector<std::thread> threads;
+    for (int t = 1; t < num_threads; ++t) {
+        threads.emplace_back(worker, t);
+    }
+    worker(0);
+    for (auto& th : threads) {
+        th.join();
+    }
+}
+
+#ifdef BENCHMARK
+// The previous two-array, recursive DSU, kept only for comparison.
+struct LegacyDSU {
+    std::vector<int> parent;
+    std::vector<int> sz;
+    int components;
+
+    LegacyDSU(int n) {
         parent.resize(n + 1);
-        // std::iota fills the range with sequentially increasing values.
         std::iota(parent.begin(), parent.end(), 0);
         sz.assign(n + 1, 1);
         components = n;
     }
 
-    // Finds the representative (or root) of the set containing element 'i' with path compression.
     int find(int i) {
         if (parent[i] == i) {
             return i;
         }
-        // Path compression: set the parent of i directly to the root.
         return parent[i] = find(parent[i]);
     }
 
-    // Merges the sets containing elements 'i' and 'j' with union by size.
     void unite(int i, int j) {
         int root_i = find(i);
         int root_j = find(j);
-        // If they are not already in the same set, merge them.
         if (root_i != root_j) {
-            // Union by size: attach the smaller tree to the root of the larger tree.
             if (sz[root_i] < sz[root_j]) {
                 std::swap(root_i, root_j);
             }
             parent[root_j] = root_i;
             sz[root_i] += sz[root_j];
-            // Merging two components reduces the total number of components by one.
             components--;
         }
     }
 };
 
-int main() {
+// Runs every union from 'edges' and then one find per element.
+template <typename T>
+double time_dsu(int n, const std::vector<std::pair<int, int>>& edges, long long& checksum) {
+    auto start = std::chrono::steady_clock::now();
+    T dsu(n);
+    for (const auto& e : edges) {
+        dsu.unite(e.first, e.second);
+    }
+    for (int i = 1; i <= n; ++i) {
+        checksum += dsu.find(i) == dsu.find(1);
+    }
+    checksum += dsu.components;
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Compares the packed DSU with the legacy one on random, chain and star unions.
+void run_benchmark() {
+    const int n = 10000000;
+    std::mt19937 rng(12345);
+    std::vector<std::pair<std::string, std::vector<std::pair<int, int>>>> patterns(3);
+    patterns[0].first = "random";
+    for (int i = 0; i < n; ++i) {
+        patterns[0].second.push_back({(int)(rng() % n) + 1, (int)(rng() % n) + 1});
+    }
+    patterns[1].first = "chain";
+    for (int i = 1; i < n; ++i) {
+        patterns[1].second.push_back({i, i + 1});
+    }
+    patterns[2].first = "star";
+    for (int i = 2; i <= n; ++i) {
+        patterns[2].second.push_back({i, 1});
+    }
+
+    for (const auto& [name, edges] : patterns) {
+        long long legacy_sum = 0, packed_sum = 0;
+        double legacy = time_dsu<LegacyDSU>(n, edges, legacy_sum);
+        double packed = time_dsu<DSU>(n, edges, packed_sum);
+        std::cout << name << ": legacy " << legacy << " s, packed " << packed
+                  << " s, speedup " << legacy / packed
+                  << (legacy_sum == packed_sum ? "" : " (MISMATCH)") << "\n";
+    }
+
+    // Concurrent ingestion of the random pattern at increasing thread counts.
+    const auto& edges = patterns[0].second;
+    DSU reference(n);
+    for (const auto& e : edges) {
+        reference.unite(e.first, e.second);
+    }
+    double base = 0;
+    for (int threads : {1, 2, 4, 8, 16, 32}) {
+        auto start = std::chrono::steady_clock::now();
+        ConcurrentDSU dsu(n);
+        parallel_unite(dsu, edges, [](int) { return true; }, threads);
+        double secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        if (threads == 1) base = secs;
+        std::cout << "concurrent " << threads << " threads: " << secs << " s, speedup "
+                  << base / secs << (dsu.components == reference.components ? "" : " (MISMATCH)")
+                  << "\n";
+    }
+}
+#endif
+
+// Usage: ./uf [threads]   (defaults to all hardware threads)
+int main(int argc, char* argv[]) {
+#ifdef BENCHMARK
+    run_benchmark();
+    return 0;
+#endif
+
+    int num_threads = argc > 1 ? std::atoi(argv[1]) : std::thread::hardware_concurrency();
+    num_threads = std::max(1, num_threads);
+
     // Fast I/O
     std::ios_base::sync_with_stdio(false);
     std::cin.tie(NULL);
@@ -72,15 +218,17 @@ int main() {
         is_removed[queries[i]] = true;
     }
 
-    // Initialize DSU. Initially, we have 'n' components.
-    DSU dsu(n);
+    // Build the initial graph: unite nodes for all edges that are NOT deleted in
+    // the queries. This bulk load runs on all threads with the lock-free DSU.
+    // The problem statement edge indices are 1-based.
+    ConcurrentDSU initial(n);
+    parallel_unite(initial, edges, [&](int i) { return !is_removed[i + 1]; }, num_threads);
 
-    // Build the initial graph: unite nodes for all edges that are NOT deleted in the queries.
-    for (int i = 0; i < m; ++i) {
-        // The problem statement edge indices are 1-based.
-        if (!is_removed[i + 1]) {
-            dsu.unite(edges[i].first, edges[i].second);
-        }
+    // Copy the components into the sequential DSU for the reverse phase.
+    // Initially, we have 'n' components.
+    DSU dsu(n);
+    for (int i = 1; i <= n; ++i) {
+        dsu.unite(i, initial.find(i));
     }
 
     // Process queries in reverse order (i.e., add edges back)
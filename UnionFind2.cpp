@@ -1,34 +1,163 @@
 #include <iostream>
 #include <vector>
-#include <numeric>
+#include <cstdint>
+#include <algorithm>
 
-// Maximum possible value in the array or queries. Adjust if necessary.
-const int MAX_VALUE = 200005; // N + Q is a safe upper bound
+// Values can be anywhere in the int range, so they are not used as indices
+// directly. Every value seen in the array or in a type-1 query gets a dense
+// slot, and the DSU works on slots. Memory is proportional to the number of
+// distinct values instead of the value range.
 
+// Open-addressing hash map from value to slot with linear probing.
+// Keys and slots are stored in two flat arrays; slot -1 marks an empty cell.
+struct ValueIndex {
+    std::vector<int> keys;
+    std::vector<int> slots;
+    int count = 0;
+
+    ValueIndex(int expected) {
+        int cap = 16;
+        while (cap < 2 * expected) cap <<= 1;
+        keys.assign(cap, 0);
+        slots.assign(cap, -1);
+    }
+
+    static uint32_t hash(int key) {
+        uint64_t x = (uint32_t)key * 0x9e3779b97f4a7c15ULL;
+        return x >> 32;
+    }
+
+    // Returns the slot of 'key', or -1 if it has none.
+    int find(int key) const {
+        size_t mask = keys.size() - 1;
+        for (size_t i = hash(key) & mask;; i = (i + 1) & mask) {
+            if (slots[i] == -1) return -1;
+            if (keys[i] == key) return slots[i];
+        }
+    }
+
+    // Returns the slot of 'key', giving it 'next_slot' if it has none yet.
+    int insert(int key, int next_slot) {
+        if (2 * (count + 1) > (int)keys.size()) grow();
+        size_t mask = keys.size() - 1;
+        for (size_t i = hash(key) & mask;; i = (i + 1) & mask) {
+            if (slots[i] == -1) {
+                keys[i] = key;
+                slots[i] = next_slot;
+                count++;
+                return next_slot;
+            }
+            if (keys[i] == key) return slots[i];
+        }
+    }
+
+    // Doubles the table, keeping the load factor at or below 1/2.
+    void grow() {
+        std::vector<int> old_keys, old_slots;
+        old_keys.swap(keys);
+        old_slots.swap(slots);
+        keys.assign(old_keys.size() * 2, 0);
+        slots.assign(old_slots.size() * 2, -1);
+        size_t mask = keys.size() - 1;
+        for (size_t j = 0; j < old_keys.size(); ++j) {
+            if (old_slots[j] == -1) continue;
+            size_t i = hash(old_keys[j]) & mask;
+            while (slots[i] != -1) i = (i + 1) & mask;
+            keys[i] = old_keys[j];
+            slots[i] = old_slots[j];
+        }
+    }
+};
+
+// Partially persistent DSU over slots: union by size, no path compression.
+// A slot's parent is set at most once, when it stops being a root, and is
+// stamped with that time. Following only links stamped <= t walks the forest
+// exactly as it was after the t-th replacement, in O(log n) hops.
+// Each union appends one (time, value) entry to the surviving root's label
+// history, so memory grows by O(1) per update.
 struct DSU {
+    // parent[s] is the parent slot of slot s, valid from time since[s] on.
     std::vector<int> parent;
-    
-    // Constructor: Initially, every value's representative is itself.
-    DSU(int n) {
-        parent.resize(n + 1);
-        std::iota(parent.begin(), parent.end(), 0);
+    std::vector<int> since;
+    std::vector<int> sz;
+    // value[s] is the value slot s stands for; labels[s] lists (time, value)
+    // whenever the set rooted at s took a different value.
+    std::vector<int> value;
+    std::vector<std::vector<std::pair<int, int>>> labels;
+    ValueIndex index;
+    // Number of replacements applied so far.
+    int now = 0;
+
+    static constexpr int NEVER = 2147483647;
+
+    DSU(int expected) : index(expected) {
+        parent.reserve(expected);
+        since.reserve(expected);
+        sz.reserve(expected);
+        value.reserve(expected);
+        labels.reserve(expected);
+    }
+
+    // Slot of value 'x', creating a singleton set for it on first sight.
+    int slot(int x) {
+        int s = index.insert(x, parent.size());
+        if (s == (int)parent.size()) {
+            parent.push_back(s);
+            since.push_back(NEVER);
+            sz.push_back(1);
+            value.push_back(x);
+            labels.emplace_back();
+        }
+        return s;
     }
 
-    // Finds the representative of the set containing 'i' with path compression.
-    int find(int i) {
-        if (parent[i] == i) {
-            return i;
+    // Representative slot of the set containing slot 's' after the t-th replacement.
+    int find(int s, int t) const {
+        while (since[s] <= t) {
+            s = parent[s];
         }
-        return parent[i] = find(parent[i]);
+        return s;
+    }
+
+    // Value that the set rooted at 'root' stood for after the t-th replacement.
+    int label(int root, int t) const {
+        const auto& h = labels[root];
+        // Last entry with time <= t
+        int lo = 0, hi = h.size();
+        while (lo < hi) {
+            int mid = (lo + hi) / 2;
+            if (h[mid].first <= t) lo = mid + 1;
+            else hi = mid;
+        }
+        return lo == 0 ? value[root] : h[lo - 1].second;
+    }
+
+    // Value of the element whose original slot is 's', after the t-th replacement.
+    int get(int s, int t) const {
+        return label(find(s, t), t);
     }
 
-    // Merges the sets containing values 'i' and 'j'.
-    // We make the representative of j's set the parent of the representative of i's set.
-    void unite(int i, int j) {
-        int root_i = find(i);
-        int root_j = find(j);
-        if (root_i != root_j) {
-            parent[root_i] = root_j;
+    // Applies the next replacement: every x becomes y. The merged set keeps
+    // y's value, whichever root survives union by size.
+    void unite(int x, int y) {
+        now++;
+        if (x == y) {
+            return;
+        }
+        int root_x = find(slot(x), now);
+        int root_y = find(slot(y), now);
+        if (root_x != root_y) {
+            int y_value = label(root_y, now);
+            if (sz[root_x] < sz[root_y]) {
+                std::swap(root_x, root_y);
+            }
+            // root_y is now the smaller root; it goes under root_x.
+            parent[root_y] = root_x;
+            since[root_y] = now;
+            sz[root_x] += sz[root_y];
+            if (label(root_x, now) != y_value) {
+                labels[root_x].push_back({now, y_value});
+            }
         }
     }
 };
@@ -41,15 +170,18 @@ int main() {
     int n;
     std::cin >> n;
 
-    // The initial array, which we will not modify.
-    std::vector<int> initial_array(n);
+    // The initial array, which we will not modify. We keep the slot of each
+    // element rather than its value.
+    std::vector<int> initial_slot(n);
+
+    // Only values that actually occur get a slot.
+    DSU value_dsu(n);
     for (int i = 0; i < n; ++i) {
-        std::cin >> initial_array[i];
+        int x;
+        std::cin >> x;
+        initial_slot[i] = value_dsu.slot(x);
     }
 
-    // Initialize the DSU for all possible values.
-    DSU value_dsu(MAX_VALUE);
-
     int q;
     std::cin >> q;
     while (q--) {
@@ -59,19 +191,25 @@ int main() {
             int x, y;
             std::cin >> x >> y;
             // "replace all x into y" means we merge the set of x into the set of y.
-            if (x != y) {
-                value_dsu.unite(x, y);
-            }
-        } else { // type == 2
+            value_dsu.unite(x, y);
+        } else if (type == 2) {
             int idx;
             std::cin >> idx;
             // Adjust for 0-based indexing if problem is 1-based.
-            // int original_value = initial_array[idx-1]; 
-            int original_value = initial_array[idx]; 
+            // int original_slot = initial_slot[idx-1];
+            int original_slot = initial_slot[idx];
 
             // Find the final value after all transformations.
-            int final_value = value_dsu.find(original_value);
-            std::cout << final_value << "\n";
+            std::cout << value_dsu.get(original_slot, value_dsu.now) << "\n";
+        } else { // type == 3
+            int idx, t;
+            std::cin >> idx >> t;
+            int original_slot = initial_slot[idx];
+
+            // The value after only the first t replacements (t = 0 is the
+            // initial array). Times past the end mean "now".
+            t = std::max(0, std::min(t, value_dsu.now));
+            std::cout << value_dsu.get(original_slot, t) << "\n";
         }
     }
 
@@ -0,0 +1,287 @@
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <cstdint>
+
+using namespace std;
+
+// Online range-frequency queries with a wavelet matrix.
+// Unlike MOsAlgorithm.cpp, nothing has to be known in advance: the structure
+// is built once over the compressed array and every query is answered as
+// soon as it arrives, in O(log sigma) rank operations.
+// Memory is about n * ceil(log2 sigma) bits plus 1/8 of that for rank blocks.
+
+// A plain bitvector with O(1) rank and O(log n) select.
+// Cumulative popcounts are stored once per 256-bit block (4 words).
+struct BitVector {
+    vector<uint64_t> words;
+    vector<uint32_t> blocks; // blocks[b] = number of ones before block b
+    int n = 0;
+
+    BitVector() {}
+    BitVector(int n) : n(n) {
+        words.assign((n >> 6) + 1, 0);
+    }
+
+    void set(int i) {
+        words[i >> 6] |= 1ULL << (i & 63);
+    }
+
+    bool get(int i) const {
+        return (words[i >> 6] >> (i & 63)) & 1;
+    }
+
+    // Must be called after all set() calls and before any rank/select.
+    void build() {
+        blocks.assign((words.size() >> 2) + 2, 0);
+        uint32_t ones = 0;
+        for (size_t w = 0; w < words.size(); ++w) {
+            if ((w & 3) == 0) blocks[w >> 2] = ones;
+            ones += __builtin_popcountll(words[w]);
+        }
+        blocks[(words.size() + 3) >> 2] = ones;
+    }
+
+    // Number of ones in [0, i)
+    int rank1(int i) const {
+        int w = i >> 6;
+        int r = blocks[w >> 2];
+        for (int k = w & ~3; k < w; ++k) {
+            r += __builtin_popcountll(words[k]);
+        }
+        if (i & 63) r += __builtin_popcountll(words[w] << (64 - (i & 63)));
+        return r;
+    }
+
+    // Number of zeros in [0, i)
+    int rank0(int i) const {
+        return i - rank1(i);
+    }
+
+    // Position of the k-th one (0-based k), or n if there are not that many.
+    int select1(int k) const {
+        // Binary search for the last block with fewer than k+1 ones before it
+        int lo = 0, hi = (words.size() + 3) >> 2;
+        if ((int)blocks[hi] <= k) return n;
+        while (hi - lo > 1) {
+            int mid = (lo + hi) / 2;
+            if ((int)blocks[mid] <= k) lo = mid;
+            else hi = mid;
+        }
+        k -= blocks[lo];
+        int w = lo << 2;
+        while (true) {
+            int c = __builtin_popcountll(words[w]);
+            if (k < c) break;
+            k -= c;
+            w++;
+        }
+        uint64_t x = words[w];
+        while (k--) x &= x - 1; // drop the lowest k ones
+        return (w << 6) + __builtin_ctzll(x);
+    }
+
+    // Position of the k-th zero (0-based k), or n if there are not that many.
+    int select0(int k) const {
+        int lo = 0, hi = n;
+        if (rank0(n) <= k) return n;
+        // Smallest i with rank0(i + 1) > k
+        while (lo < hi) {
+            int mid = (lo + hi) / 2;
+            if (rank0(mid + 1) > k) hi = mid;
+            else lo = mid + 1;
+        }
+        return lo;
+    }
+};
+
+// Wavelet matrix over values in [0, 2^levels).
+// Level 0 holds the highest bit. At every level, elements whose bit is 0 are
+// stably moved to the front; zeros[level] is how many of them there are.
+struct WaveletMatrix {
+    int n, levels;
+    vector<BitVector> bits;
+    vector<int> zeros;
+
+    WaveletMatrix(vector<int> a, int max_value) {
+        n = a.size();
+        levels = 1;
+        while ((1LL << levels) <= max_value) levels++;
+        bits.assign(levels, BitVector(n));
+        zeros.assign(levels, 0);
+
+        vector<int> left, right;
+        for (int level = 0; level < levels; ++level) {
+            int bit = levels - 1 - level;
+            left.clear();
+            right.clear();
+            for (int i = 0; i < n; ++i) {
+                if ((a[i] >> bit) & 1) {
+                    bits[level].set(i);
+                    right.push_back(a[i]);
+                } else {
+                    left.push_back(a[i]);
+                }
+            }
+            bits[level].build();
+            zeros[level] = left.size();
+            copy(left.begin(), left.end(), a.begin());
+            copy(right.begin(), right.end(), a.begin() + left.size());
+        }
+    }
+
+    // Number of occurrences of 'value' in [l, r)
+    int rank(int value, int l, int r) const {
+        if (value < 0 || value >= (1LL << levels)) return 0;
+        for (int level = 0; level < levels; ++level) {
+            int bit = levels - 1 - level;
+            if ((value >> bit) & 1) {
+                l = zeros[level] + bits[level].rank1(l);
+                r = zeros[level] + bits[level].rank1(r);
+            } else {
+                l = bits[level].rank0(l);
+                r = bits[level].rank0(r);
+            }
+        }
+        return r - l;
+    }
+
+    // Position of the k-th occurrence (0-based k) of 'value', or -1
+    int select(int value, int k) const {
+        if (value < 0 || value >= (1LL << levels)) return -1;
+        // Walk down to find where the run of 'value' starts in the last level
+        int l = 0;
+        for (int level = 0; level < levels; ++level) {
+            int bit = levels - 1 - level;
+            if ((value >> bit) & 1) l = zeros[level] + bits[level].rank1(l);
+            else l = bits[level].rank0(l);
+        }
+        if (rank(value, 0, n) <= k) return -1;
+        // Walk back up, undoing each stable partition with select
+        int pos = l + k;
+        for (int level = levels - 1; level >= 0; --level) {
+            int bit = levels - 1 - level;
+            if ((value >> bit) & 1) pos = bits[level].select1(pos - zeros[level]);
+            else pos = bits[level].select0(pos);
+        }
+        return pos;
+    }
+
+    // k-th smallest value (0-based k) in [l, r). Requires k < r - l.
+    int kth_smallest(int l, int r, int k) const {
+        int value = 0;
+        for (int level = 0; level < levels; ++level) {
+            int l0 = bits[level].rank0(l);
+            int r0 = bits[level].rank0(r);
+            if (k < r0 - l0) {
+                l = l0;
+                r = r0;
+            } else {
+                k -= r0 - l0;
+                value |= 1 << (levels - 1 - level);
+                l = zeros[level] + (l - l0);
+                r = zeros[level] + (r - r0);
+            }
+        }
+        return value;
+    }
+
+    // Number of values strictly less than 'x' in [l, r)
+    int count_less(int l, int r, int x) const {
+        if (x <= 0) return 0;
+        if (x >= (1LL << levels)) return r - l;
+        int count = 0;
+        for (int level = 0; level < levels; ++level) {
+            int bit = levels - 1 - level;
+            int l0 = bits[level].rank0(l);
+            int r0 = bits[level].rank0(r);
+            if ((x >> bit) & 1) {
+                count += r0 - l0;
+                l = zeros[level] + (l - l0);
+                r = zeros[level] + (r - r0);
+            } else {
+                l = l0;
+                r = r0;
+            }
+        }
+        return count;
+    }
+};
+
+int main() {
+    // Fast I/O. cin stays tied to cout so every answer is flushed before the
+    // next request is read, which is what an interactive client needs.
+    ios_base::sync_with_stdio(false);
+
+    int n;
+    cin >> n;
+    vector<int> a(n);
+    for (int i = 0; i < n; ++i) {
+        cin >> a[i];
+    }
+
+    // --- Coordinate Compression ---
+    vector<int> values(a);
+    sort(values.begin(), values.end());
+    values.erase(unique(values.begin(), values.end()), values.end());
+    vector<int> c(n);
+    for (int i = 0; i < n; ++i) {
+        c[i] = lower_bound(values.begin(), values.end(), a[i]) - values.begin();
+    }
+    WaveletMatrix wm(c, max(0, (int)values.size() - 1));
+
+    // prev[i] + 1, where prev[i] is the last index before i holding the same
+    // value (-1 if none). The distinct values in [l, r) are exactly the
+    // positions whose previous occurrence lies before l.
+    vector<int> prev(n), last(values.size(), -1);
+    for (int i = 0; i < n; ++i) {
+        prev[i] = last[c[i]] + 1;
+        last[c[i]] = i;
+    }
+    WaveletMatrix prev_wm(prev, n);
+
+    // Queries (1-based, inclusive ranges):
+    //   1 l r x  -> occurrences of x in a[l..r]
+    //   2 l r k  -> k-th smallest value in a[l..r]
+    //   3 l r x  -> number of elements >= x in a[l..r]
+    //   4 l r    -> number of distinct values in a[l..r]
+    //   5 x k    -> 1-based position of the k-th occurrence of x, or -1
+    int type;
+    while (cin >> type) {
+        if (type == 5) {
+            int x, k;
+            cin >> x >> k;
+            int pos = -1;
+            auto it = lower_bound(values.begin(), values.end(), x);
+            if (it != values.end() && *it == x && k >= 1) {
+                pos = wm.select(it - values.begin(), k - 1);
+            }
+            cout << (pos == -1 ? -1 : pos + 1) << "\n";
+            continue;
+        }
+
+        int l, r;
+        cin >> l >> r;
+        l--; // Convert to a 0-based half-open range [l, r)
+        if (type == 1) {
+            int x;
+            cin >> x;
+            auto it = lower_bound(values.begin(), values.end(), x);
+            bool present = it != values.end() && *it == x;
+            cout << (present ? wm.rank(it - values.begin(), l, r) : 0) << "\n";
+        } else if (type == 2) {
+            int k;
+            cin >> k;
+            cout << values[wm.kth_smallest(l, r, k - 1)] << "\n";
+        } else if (type == 3) {
+            int x;
+            cin >> x;
+            int idx = lower_bound(values.begin(), values.end(), x) - values.begin();
+            cout << (r - l) - wm.count_less(l, r, idx) << "\n";
+        } else {
+            cout << prev_wm.count_less(l, r, l + 1) << "\n";
+        }
+    }
+
+    return 0;
+}
@@ -1,110 +1,119 @@
 #include <iostream>
 #include <vector>
 #include <algorithm>
-#include <stack>
+#include "lowlink.h"
+#include "forestlca.h"
 
 using namespace std;
 
-const int MAX_NODES = 200005;
-
-vector<int> adj[MAX_NODES];
-vector<int> disc, low;
-stack<pair<int, int> > edge_stack;
-vector<vector<pair<int, int> > > bccs; // To store the components
-int timer;
-
 /**
- * @brief DFS function to find biconnected components.
- * @param u The current vertex being visited.
- * @param p The parent of the current vertex in the DFS tree.
+ * @brief Block-cut tree: one node per vertex (0 .. V-1) and one per BCC
+ * (V + i), with an edge between every BCC and each of its vertices.
+ * A vertex that lies in two or more BCCs is exactly an articulation point, and
+ * the vertex nodes strictly inside the tree path from u to v are exactly the
+ * articulation points that every u-v path in the graph must cross.
+ * Paths are measured with an O(1) LCA (forestlca.h).
  */
-void find_bccs(int u, int p = -1) {
-    disc[u] = low[u] = timer++;
-
-    for (int v : adj[u]) {
-        // We consider the edge (u, v) only once.
-        // If v is parent, it's already handled.
-        if (v == p) continue;
-
-        // If v is not visited yet, push edge (u, v) to stack and recurse.
-        // We check disc[v] < disc[u] to ensure we only push an edge once for undirected graphs.
-        if (disc[v] == -1) {
-            edge_stack.push(make_pair(u,v));
-            find_bccs(v, u);
+struct BlockCutTree {
+    int V;
+    CSRGraph tree;
+    ForestLCA forest;
 
-            // After recursion, update low-link value of u.
-            low[u] = min(low[u], low[v]);
+    BlockCutTree(int V, const vector<int>& bcc_offset, const vector<int>& bcc_vertices)
+        : V(V), tree(build_tree(V, bcc_offset, bcc_vertices)), forest(tree) {}
 
-            // If u is an articulation point (or the root), it separates a BCC.
-            if (low[v] >= disc[u]) {
-                vector<pair<int, int> > current_bcc;
-                while (true) {
-                    pair<int, int> current_edge = edge_stack.top();
-                    edge_stack.pop();
-                    current_bcc.push_back(current_edge);
-                    if (current_edge.first == u && current_edge.second == v) {
-                        break;
-                    }
-                }
-                bccs.push_back(current_bcc);
+    static CSRGraph build_tree(int V, const vector<int>& bcc_offset, const vector<int>& bcc_vertices) {
+        int blocks = bcc_offset.size() - 1;
+        vector<pair<int, int>> edges;
+        edges.reserve(bcc_vertices.size());
+        for (int b = 0; b < blocks; ++b) {
+            for (int k = bcc_offset[b]; k < bcc_offset[b + 1]; ++k) {
+                edges.push_back({bcc_vertices[k], V + b});
             }
-        } 
-        // If v is already visited, it's a back edge. Update low[u].
-        // Also push the back edge to the stack if it represents a new path upwards.
-        else if (disc[v] < disc[u]) {
-             low[u] = min(low[u], disc[v]);
-             edge_stack.push(make_pair(u,v));
         }
+        return CSRGraph::from_edges(V + blocks, edges, false);
+    }
+
+    /**
+     * @brief Does every path from u to v pass through w?
+     * True when w is u or v; false when u and v are not connected.
+     */
+    bool separates(int u, int v, int w) const {
+        if (!forest.connected(u, v)) return false;
+        if (w == u || w == v) return true;
+        if (!forest.connected(w, u)) return false;
+        return forest.dist(u, w) + forest.dist(w, v) == forest.dist(u, v);
+    }
+
+    /**
+     * @brief Number of articulation points (other than u and v) on every u-v path,
+     * or -1 if u and v are not connected.
+     */
+    int separating_count(int u, int v) const {
+        if (!forest.connected(u, v)) return -1;
+        if (u == v) return 0;
+        // The path alternates vertex and block nodes: u, B, x, B, ..., v
+        return forest.dist(u, v) / 2 - 1;
     }
-}
+};
 
-int main() {
+// Usage: ./biconnectedcomponents [edge file]   (reads the edges from stdin if no file is given)
+int main(int argc, char* argv[]) {
     // Fast I/O
     ios_base::sync_with_stdio(false);
     cin.tie(NULL);
 
-    int V, E;
-    cout << "Enter number of vertices and edges: ";
-    cin >> V >> E;
+    int V;
+    CSRGraph g;
+    if (argc > 1) {
+        // Binary edge file (format in csrgraph.h), memory-mapped instead of parsed
+        g = CSRGraph::from_edge_file(argv[1], false, true);
+        V = g.n;
+    } else {
+        int E;
+        cout << "Enter number of vertices and edges: ";
+        cin >> V >> E;
 
-    cout << "Enter " << E << " edges (u v):\n";
-    for (int i = 0; i < E; ++i) {
-        int u, v;
-        cin >> u >> v;
-        adj[u].push_back(v);
-        adj[v].push_back(u);
-    }
-
-    // Initialize data structures
-    disc.assign(V, -1);
-    low.assign(V, -1);
-    timer = 0;
-
-    // Iterate through all vertices to handle disconnected graphs
-    for (int i = 0; i < V; ++i) {
-        if (disc[i] == -1) {
-            find_bccs(i);
-            
-            // Any remaining edges on the stack form the last BCC
-            if (!edge_stack.empty()) {
-                vector<pair<int, int> > last_bcc;
-                while (!edge_stack.empty()) {
-                    last_bcc.push_back(edge_stack.top());
-                    edge_stack.pop();
-                }
-                bccs.push_back(last_bcc);
-            }
+        cout << "Enter " << E << " edges (u v):\n";
+        vector<pair<int, int>> edges(E);
+        for (int i = 0; i < E; ++i) {
+            cin >> edges[i].first >> edges[i].second;
         }
+        g = CSRGraph::from_edges(V, edges, false, true);
     }
 
+    // One iterative DFS over every component (lowlink.h)
+    Lowlink lowlink(g);
+    const vector<int>& bcc_offset = lowlink.bcc_offset;
+    const vector<int>& bcc_vertices = lowlink.bcc_vertices;
+
     cout << "\nBiconnected Components are:\n";
-    for (int i = 0; i < bccs.size(); ++i) {
+    for (int i = 0; i < lowlink.bcc_count(); ++i) {
         cout << "Component " << i + 1 << ": ";
-        for (const auto& edge : bccs[i]) {
-            cout << "(" << edge.first << "-" << edge.second << ") ";
+        for (int k = bcc_offset[i]; k < bcc_offset[i + 1]; ++k) {
+            cout << bcc_vertices[k] << " ";
         }
         cout << "\n";
     }
 
+    // Queries on the block-cut tree:
+    //   1 u v w : does every u-v path pass through w? (yes / no)
+    //   2 u v   : number of articulation points separating u and v (-1 if not connected)
+    BlockCutTree bct(V, bcc_offset, bcc_vertices);
+    int q = 0;
+    cout << "\nEnter number of queries: ";
+    cin >> q;
+    while (q-- > 0) {
+        int type, u, v;
+        cin >> type >> u >> v;
+        if (type == 1) {
+            int w;
+            cin >> w;
+            cout << (bct.separates(u, v, w) ? "yes" : "no") << "\n";
+        } else {
+            cout << bct.separating_count(u, v) << "\n";
+        }
+    }
+
     return 0;
 }
\ No newline at end of file
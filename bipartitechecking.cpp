@@ -1,3 +1,5 @@
+#include "csrgraph.h"
+
 //checks if a graph is bipartite or not.
 // also finds the connected components of the graph.
 
@@ -26,4 +28,220 @@ bool checkBipartite(int start,ll color,vector<ll>&nodes){
     }
 
     return flag;
-}
\ No newline at end of file
+}
+
+
+// Direction-optimizing BFS (Beamer et al.) for bipartiteness and components
+// on a CSRGraph from csrgraph.h, built undirected.
+// Nodes are colored by BFS level parity. A graph is bipartite iff no edge joins
+// two nodes on the same level, so the BFS itself never has to look at colors
+// and one scan over the edges afterwards decides it.
+// Each level is expanded either
+//   - top-down: the frontier list claims its unvisited neighbours, or
+//   - bottom-up: every unvisited node looks for any parent in the frontier
+//     bitmap and stops at the first one it finds,
+// switching to bottom-up once the frontier's edges exceed 1/ALPHA of the
+// unexplored edges, and back once the frontier drops below n/BETA nodes.
+// The middle levels of a low-diameter graph then cost a fraction of their
+// edges. With threads > 1 each level and the final scan are split over
+// threads; small levels run inline.
+struct BipartiteBFS{
+    static const int ALPHA=14,BETA=24,GRAIN=4096;
+    const CSRGraph &g;
+    int n,threads;
+    vector<atomic<int> > level;       // BFS level inside the component, -1 = unvisited
+    vector<uint64_t> in_frontier;     // Bitmap of the current frontier (bottom-up only)
+
+    // --- Results ---
+    bool bipartite;
+    vector<int> comp_offset,comp_nodes; // Nodes of component i: comp_nodes[comp_offset[i] .. comp_offset[i+1])
+    vector<int> comp_of;
+    vector<char> comp_bipartite;
+
+    BipartiteBFS(const CSRGraph &g,int threads=1):g(g),n(g.n),threads(max(1,threads)),level(g.n),
+        in_frontier((g.n+63)/64,0){
+        for(int v=0;v<n;v++)level[v].store(-1,memory_order_relaxed);
+        comp_offset.assign(1,0);
+        comp_of.assign(n,-1);
+        long long unexplored=g.to.size();
+        for(int root=0;root<n;root++){
+            if(level[root].load(memory_order_relaxed)!=-1)continue;
+            unexplored-=search(root,unexplored);
+        }
+        check();
+    }
+
+    int color(int v)const{return level[v].load(memory_order_relaxed)&1;}
+
+    // Runs f(t, begin, end) on contiguous parts of [0, n) whose boundaries
+    // are multiples of 64, so no two threads share a bitmap word.
+    template<class F>
+    void parallel_for(int m,F f){
+        if(threads==1 || m<GRAIN){
+            f(0,0,m);
+            return;
+        }
+        vector<thread> pool;
+        for(int t=1;t<threads;t++){
+            int b=(long long)m*t/threads/64*64,e=t+1==threads?m:(long long)m*(t+1)/threads/64*64;
+            pool.emplace_back(f,t,b,e);
+        }
+        f(0,0,(long long)m/threads/64*64);
+        for(auto &th : pool)th.join();
+    }
+
+    // BFS from root; returns the number of arcs leaving the nodes it visited.
+    long long search(int root,long long unexplored){
+        int id=comp_offset.size()-1;
+        vector<int> frontier(1,root);
+        vector<vector<int> > next(threads);
+        level[root].store(0,memory_order_relaxed);
+        comp_nodes.push_back(root);
+        long long visited_arcs=g.degree(root),frontier_arcs=g.degree(root);
+        bool bottom_up=false;
+
+        for(int depth=1;!frontier.empty();depth++){
+            if(!bottom_up && frontier_arcs>(unexplored-visited_arcs)/ALPHA)bottom_up=true;
+            else if(bottom_up && (long long)frontier.size()*BETA<n)bottom_up=false;
+
+            if(bottom_up){
+                for(int v : frontier)in_frontier[v>>6]|=1ULL<<(v&63);
+                parallel_for(n,[&](int t,int b,int e){
+                    next[t].clear();
+                    for(int v=b;v<e;v++){
+                        if(level[v].load(memory_order_relaxed)!=-1)continue;
+                        for(uint32_t u : g.neighbors(v)){
+                            if(in_frontier[u>>6]>>(u&63)&1){
+                                level[v].store(depth,memory_order_relaxed);
+                                next[t].push_back(v);
+                                break;
+                            }
+                        }
+                    }
+                });
+                for(int v : frontier)in_frontier[v>>6]=0;
+            }else{
+                parallel_for(frontier.size(),[&](int t,int b,int e){
+                    next[t].clear();
+                    for(int i=b;i<e;i++){
+                        for(uint32_t v : g.neighbors(frontier[i])){
+                            int expected=-1;
+                            if(level[v].load(memory_order_relaxed)==-1 &&
+                               level[v].compare_exchange_strong(expected,depth,memory_order_relaxed)){
+                                next[t].push_back(v);
+                            }
+                        }
+                    }
+                });
+            }
+
+            frontier.clear();
+            frontier_arcs=0;
+            for(auto &part : next){
+                for(int v : part)frontier_arcs+=g.degree(v);
+                frontier.insert(frontier.end(),part.begin(),part.end());
+                part.clear();
+            }
+            visited_arcs+=frontier_arcs;
+            comp_nodes.insert(comp_nodes.end(),frontier.begin(),frontier.end());
+        }
+
+        for(int k=comp_offset.back();k<(int)comp_nodes.size();k++)comp_of[comp_nodes[k]]=id;
+        comp_offset.push_back(comp_nodes.size());
+        return visited_arcs;
+    }
+
+    // An edge inside one level closes an odd cycle.
+    void check(){
+        comp_bipartite.assign(comp_offset.size()-1,1);
+        vector<vector<int> > odd(threads);
+        parallel_for(n,[&](int t,int b,int e){
+            for(int u=b;u<e;u++){
+                int lu=level[u].load(memory_order_relaxed);
+                for(uint32_t v : g.neighbors(u)){
+                    if(level[v].load(memory_order_relaxed)==lu){
+                        odd[t].push_back(comp_of[u]);
+                        break;
+                    }
+                }
+            }
+        });
+        bipartite=true;
+        for(auto &part : odd){
+            for(int c : part)comp_bipartite[c]=0;
+            if(!part.empty())bipartite=false;
+        }
+    }
+};
+
+// Online bipartiteness: edges only ever get added, and each insertion is
+// checked in near O(alpha(n)) instead of recoloring the whole graph.
+// A DSU over the components keeps, for every node, its color parity relative
+// to its parent (relative to the root once the path is compressed). An edge
+// inside one component whose ends have the same parity closes an odd cycle.
+// An edge between two components hangs the smaller root under the larger
+// one, with whatever parity puts the two ends on opposite sides.
+// p[x] < 0 marks a root and holds -size, as in UnionFind.cpp.
+struct ParityDSU{
+    vector<int> p;
+    vector<char> parity,odd;    // odd[root]: the component has an odd cycle
+    int odd_components=0,edges_added=0;
+    int first_odd_edge=-1;      // Index (0-based, in insertion order) of the first odd-cycle edge
+    pair<int,int> first_odd_ends;
+
+    ParityDSU(int n):p(n+1,-1),parity(n+1,0),odd(n+1,0){}
+
+    // Returns the root of x and sets px to x's parity relative to it.
+    int find(int x,int &px){
+        int r=x,acc=0;
+        while(p[r]>=0){
+            acc^=parity[r];
+            r=p[r];
+        }
+        px=acc;
+        // Point the whole path at the root, fixing up each node's parity
+        while(p[x]>=0){
+            int next=p[x],rest=acc^parity[x];
+            p[x]=r;
+            parity[x]=acc;
+            x=next;
+            acc=rest;
+        }
+        return r;
+    }
+
+    // Adds edge (u, v); returns false if u's component is not bipartite afterwards.
+    bool add_edge(int u,int v){
+        int pu,pv;
+        int ru=find(u,pu),rv=find(v,pv);
+        int index=edges_added++;
+        if(ru==rv){
+            if(pu==pv && !odd[ru]){
+                odd[ru]=1;
+                odd_components++;
+                if(first_odd_edge==-1){
+                    first_odd_edge=index;
+                    first_odd_ends=make_pair(u,v);
+                }
+            }
+            return !odd[ru];
+        }
+        if(p[ru]>p[rv])swap(ru,rv);
+        p[ru]+=p[rv];
+        p[rv]=ru;
+        parity[rv]=pu^pv^1;
+        if(odd[rv]){
+            if(odd[ru])odd_components--;
+            odd[ru]=1;
+        }
+        return !odd[ru];
+    }
+
+    bool bipartite(int x){int px;return !odd[find(x,px)];}
+    bool all_bipartite()const{return odd_components==0;}
+    // The component that first stopped being bipartite, as its current root
+    // (it may have grown since), or -1 if every component is still bipartite.
+    int first_odd_component(){int px;return first_odd_edge==-1?-1:find(first_odd_ends.first,px);}
+    // Colors of u and v differ, for u and v in one bipartite component.
+    bool opposite(int u,int v){int pu,pv;find(u,pu);find(v,pv);return pu!=pv;}
+};
\ No newline at end of file
@@ -1,99 +1,69 @@
 #include <iostream>
 #include <vector>
 #include <algorithm>
+#include "lowlink.h"
+#include "forestlca.h"
 
 using namespace std;
 
-const int MAX_NODES = 200005;
-
-vector<int> adj[MAX_NODES];
-vector<int> disc, low;
-vector<bool> is_bridge;
-vector<int> component;
-int timer, component_count;
-
-/**
- * @brief Step 1: DFS to find all bridges in the graph.
- * @param u The current vertex being visited.
- * @param p The parent of the current vertex in the DFS tree.
- */
-void find_bridges(int u, int p = -1) {
-    disc[u] = low[u] = timer++;
-
-    for (int v : adj[u]) {
-        if (v == p) continue;
-
-        if (disc[v] != -1) {
-            low[u] = min(low[u], disc[v]);
-        } else {
-            find_bridges(v, u);
-            low[u] = min(low[u], low[v]);
-            if (low[v] > disc[u]) {
-                // Mark the edge u-v as a bridge
-                // Note: Storing bridges might be complex with parallel edges.
-                // A common way is to use a map or pair of pairs.
-                // For this code, we'll just conceptually remove them in the next step.
-                // To do this simply, we will need to store edges and their indices.
-                // The provided implementation takes a simpler route by re-traversing.
-            }
-        }
-    }
-}
-
-
 /**
- * @brief Step 2: DFS to find connected components on the graph without bridges.
- * @param u The current vertex to visit.
+ * @brief Bridge tree: every 2-edge-connected component contracted to a node,
+ * joined by the bridges. It is a forest, kept in CSR form. The bridges between
+ * u and v are the edges on the tree path between their components, so a
+ * query is the tree distance between them, with an O(1) LCA (forestlca.h).
  */
-void find_components(int u) {
-    component[u] = component_count;
-    for (int v : adj[u]) {
-        // A bridge is an edge (u, v) where low[v] > disc[u] or low[u] > disc[v]
-        bool is_edge_a_bridge = (low[v] > disc[u] || low[u] > disc[v]);
-        
-        // Traverse the edge only if it's NOT a bridge and the neighbor is not visited
-        if (!is_edge_a_bridge && component[v] == -1) {
-            find_components(v);
-        }
+struct BridgeTree {
+    CSRGraph tree;
+    ForestLCA forest;
+
+    BridgeTree(int nodes, const vector<pair<int, int>>& bridges)
+        : tree(CSRGraph::from_edges(nodes, bridges, false)), forest(tree) {}
+
+    /**
+     * @brief Number of bridges on every path between components a and b,
+     * or -1 if they are in different trees.
+     */
+    int bridges_between(int a, int b) const {
+        if (!forest.connected(a, b)) return -1;
+        return forest.dist(a, b);
     }
-}
+};
 
-
-int main() {
+// Usage: ./bridgeconnected [edge file]   (reads the edges from stdin if no file is given)
+int main(int argc, char* argv[]) {
     // Fast I/O
     ios_base::sync_with_stdio(false);
     cin.tie(NULL);
 
-    int V, E;
-    cout << "Enter number of vertices and edges: ";
-    cin >> V >> E;
-
-    cout << "Enter " << E << " edges (u v):\n";
-    for (int i = 0; i < E; ++i) {
-        int u, v;
-        cin >> u >> v;
-        adj[u].push_back(v);
-        adj[v].push_back(u);
-    }
-
-    // --- Step 1: Find all bridges ---
-    disc.assign(V, -1);
-    low.assign(V, -1);
-    timer = 0;
-    for (int i = 0; i < V; ++i) {
-        if (disc[i] == -1) {
-            find_bridges(i);
+    int V;
+    CSRGraph g;
+    if (argc > 1) {
+        // Binary edge file (format in csrgraph.h), memory-mapped instead of parsed
+        g = CSRGraph::from_edge_file(argv[1], false, true);
+        V = g.n;
+    } else {
+        int E;
+        cout << "Enter number of vertices and edges: ";
+        cin >> V >> E;
+
+        cout << "Enter " << E << " edges (u v):\n";
+        vector<pair<int, int>> edges(E);
+        for (int i = 0; i < E; ++i) {
+            cin >> edges[i].first >> edges[i].second;
         }
+        g = CSRGraph::from_edges(V, edges, false, true);
     }
-    
-    // --- Step 2: Find components in the graph without bridges ---
-    component.assign(V, -1);
-    component_count = 0;
+
+    // --- Bridges and 2-edge-connected components in one DFS (lowlink.h) ---
+    Lowlink lowlink(g);
+
+    // Number the components in order of their smallest vertex
+    int component_count = 0;
+    vector<int> number(lowlink.two_edge_count, -1), component(V);
     for (int i = 0; i < V; ++i) {
-        if (component[i] == -1) {
-            find_components(i);
-            component_count++;
-        }
+        int& c = number[lowlink.two_edge_component[i]];
+        if (c == -1) c = component_count++;
+        component[i] = c;
     }
 
     // --- Print the results ---
@@ -111,5 +81,22 @@ int main() {
         cout << "\n";
     }
 
+    // --- Contract the components into the bridge tree ---
+    vector<pair<int, int>> tree_edges;
+    for (const auto& [u, v] : lowlink.bridge_ends) {
+        tree_edges.push_back({component[u], component[v]});
+    }
+    BridgeTree tree(component_count, tree_edges);
+
+    // Queries "u v": how many bridges lie on every u-v path (-1 if not connected)
+    int q = 0;
+    cout << "\nEnter number of queries: ";
+    cin >> q;
+    while (q-- > 0) {
+        int u, v;
+        cin >> u >> v;
+        cout << tree.bridges_between(component[u], component[v]) << "\n";
+    }
+
     return 0;
 }
\ No newline at end of file
@@ -1,76 +1,40 @@
 #include <iostream>
 #include <vector>
-#include <algorithm>
+#include "lowlink.h"
 
 using namespace std;
 
-const int MAX_NODES = 200005;
-
-vector<int> adj[MAX_NODES];
-vector<int> disc, low;
-vector<pair<int, int>> bridges;
-int timer;
-
-/**
- * @brief A Depth First Search function to find bridges in the graph.
- * @param u The current vertex being visited.
- * @param p The parent of the current vertex in the DFS tree.
- */
-void find_bridges(int u, int p = -1) {
-    disc[u] = low[u] = timer++;
-
-    for (int v : adj[u]) {
-        // Ignore the edge leading back to the parent
-        if (v == p) continue;
-
-        if (disc[v] != -1) { // If v is already visited, it's a back edge
-            low[u] = min(low[u], disc[v]);
-        } else { // If v is not visited, it's a tree edge
-            find_bridges(v, u);
-            low[u] = min(low[u], low[v]);
-
-            // This is the condition for an edge (u, v) to be a bridge
-            if (low[v] > disc[u]) {
-                bridges.push_back({u, v});
-            }
-        }
-    }
-}
-
-int main() {
+// Usage: ./bridges [edge file]   (reads the edges from stdin if no file is given)
+int main(int argc, char* argv[]) {
     // Fast I/O
     ios_base::sync_with_stdio(false);
     cin.tie(NULL);
 
-    int V, E;
-    cout << "Enter number of vertices and edges: ";
-    cin >> V >> E;
-
-    cout << "Enter " << E << " edges (u v):\n";
-    for (int i = 0; i < E; ++i) {
-        int u, v;
-        cin >> u >> v;
-        adj[u].push_back(v);
-        adj[v].push_back(u);
-    }
-
-    // Initialize data structures
-    disc.assign(V, -1);
-    low.assign(V, -1);
-    timer = 0;
-
-    // Iterate through all vertices to handle disconnected graphs
-    for (int i = 0; i < V; ++i) {
-        if (disc[i] == -1) {
-            find_bridges(i);
+    CSRGraph g;
+    if (argc > 1) {
+        // Binary edge file (format in csrgraph.h), memory-mapped instead of parsed
+        g = CSRGraph::from_edge_file(argv[1], false, true);
+    } else {
+        int V, E;
+        cout << "Enter number of vertices and edges: ";
+        cin >> V >> E;
+
+        cout << "Enter " << E << " edges (u v):\n";
+        vector<pair<int, int>> edges(E);
+        for (int i = 0; i < E; ++i) {
+            cin >> edges[i].first >> edges[i].second;
         }
+        g = CSRGraph::from_edges(V, edges, false, true);
     }
 
+    // One iterative DFS over every component (lowlink.h)
+    Lowlink lowlink(g);
+
     cout << "\nBridges are:\n";
-    if (bridges.empty()) {
+    if (lowlink.bridge_ends.empty()) {
         cout << "None\n";
     } else {
-        for (const auto& edge : bridges) {
+        for (const auto& edge : lowlink.bridge_ends) {
             cout << edge.first << " - " << edge.second << "\n";
         }
     }
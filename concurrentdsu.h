@@ -0,0 +1,73 @@
+#ifndef CONCURRENTDSU_H
+#define CONCURRENTDSU_H
+
+#include <vector>
+#include <atomic>
+#include <cstdint>
+#include <utility>
+
+// A lock-free DSU that many threads can unite/find on concurrently.
+// Randomized linking by index in the style of Jayanti and Tarjan: every element
+// gets a fixed pseudo-random priority, and a root is only ever linked below a
+// root of higher priority with a single CAS. find() uses path splitting, where
+// each hop tries to CAS its parent to its grandparent and ignores failures.
+// A successful link CAS is the linearization point of unite(), so every merge
+// is counted exactly once in 'components'.
+struct ConcurrentDSU {
+    std::vector<std::atomic<int>> parent;
+    std::atomic<int> components;
+
+    ConcurrentDSU(int n) : parent(n + 1), components(n) {
+        for (int i = 0; i <= n; ++i) {
+            parent[i].store(i, std::memory_order_relaxed);
+        }
+    }
+
+    // A fixed random-looking order on elements (splitmix64 finalizer), with
+    // the index as a tie-breaker so the order is total.
+    static uint64_t priority(int i) {
+        uint64_t x = (uint64_t)i + 0x9e3779b97f4a7c15ULL;
+        x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+        return ((x ^ (x >> 31)) << 32) | (uint32_t)i;
+    }
+
+    int find(int i) {
+        while (true) {
+            int p = parent[i].load(std::memory_order_acquire);
+            if (p == i) {
+                return i;
+            }
+            int g = parent[p].load(std::memory_order_acquire);
+            if (p != g) {
+                // Path splitting; losing this race is harmless.
+                parent[i].compare_exchange_weak(p, g, std::memory_order_release,
+                                                std::memory_order_relaxed);
+            }
+            i = p;
+        }
+    }
+
+    // Returns true if this call merged two different sets.
+    bool unite(int i, int j) {
+        while (true) {
+            i = find(i);
+            j = find(j);
+            if (i == j) {
+                return false;
+            }
+            if (priority(i) > priority(j)) {
+                std::swap(i, j);
+            }
+            // Link the lower-priority root under the other one, but only if it
+            // is still a root; otherwise someone linked it first, so retry.
+            int expected = i;
+            if (parent[i].compare_exchange_strong(expected, j, std::memory_order_acq_rel)) {
+                components.fetch_sub(1, std::memory_order_relaxed);
+                return true;
+            }
+        }
+    }
+};
+
+#endif
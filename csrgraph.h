@@ -0,0 +1,210 @@
+#ifndef CSRGRAPH_H
+#define CSRGRAPH_H
+
+#include <iostream>
+#include <vector>
+#include <tuple>
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <utility>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "threadpool.h"
+
+// Immutable compressed sparse row graph shared by the graph tools.
+// The arcs leaving node u are to[offset[u] .. offset[u+1]); w[] and id[] are
+// parallel to to[] and only filled when asked for. Node ids are 32-bit,
+// offsets are 64-bit so more than 2^32 arcs fit. For an undirected graph
+// every edge is stored in both directions and both arcs carry the same id,
+// which is the edge's index in the input.
+struct CSRGraph {
+    uint32_t n = 0;
+    std::vector<uint64_t> offset;
+    std::vector<uint32_t> to;
+    std::vector<long long> w;   // Empty unless weighted
+    std::vector<uint32_t> id;   // Empty unless edge ids were requested
+
+    struct Range {
+        const uint32_t *b, *e;
+        const uint32_t* begin() const { return b; }
+        const uint32_t* end() const { return e; }
+    };
+
+    Range neighbors(uint32_t u) const {
+        return {to.data() + offset[u], to.data() + offset[u + 1]};
+    }
+
+    uint64_t degree(uint32_t u) const {
+        return offset[u + 1] - offset[u];
+    }
+
+    // Two-pass counting sort: count the out-degrees, prefix-sum them into
+    // offsets, then scatter every arc into place. get(i) returns the i-th edge
+    // as (u, v, weight); it is called twice per edge, from any thread, and
+    // never stored, so the edges can come straight from a memory-mapped file.
+    // Both passes are split over a ThreadPool (threadpool.h). Thread t owns a
+    // fixed, contiguous range of edges and counts them into its own degree
+    // histogram. The histograms are then turned into per-thread write cursors
+    // (in row u, thread t writes after threads 0 .. t-1), so the scatter needs
+    // no atomics and every row keeps its arcs in input order, exactly as a
+    // single thread would. threads = 0 uses every hardware thread, capped so
+    // the histograms never take more memory than the arcs themselves.
+    // Endpoints are checked against n in the counting pass, and edge ids must
+    // fit in 32 bits.
+    template <typename Get>
+    static CSRGraph build(uint32_t n, uint64_t m, Get get, bool directed, bool weighted, bool with_ids,
+                          int threads = 0) {
+        if (with_ids && m > UINT32_MAX) fail("too many edges for 32-bit edge ids");
+        if (threads <= 0) {
+            uint64_t arcs = directed ? m : 2 * m;
+            uint64_t cap = std::max<uint64_t>(1, arcs / (2 * ((uint64_t)n + 1)));
+            threads = std::min<uint64_t>(std::max(1u, std::thread::hardware_concurrency()), cap);
+        }
+        // Below the grain parallel_for runs inline, as part 0 only
+        if (m < (uint64_t)ThreadPool::GRAIN) threads = 1;
+        ThreadPool pool(threads);
+
+        CSRGraph g;
+        g.n = n;
+        g.offset.assign((size_t)n + 1, 0);
+        std::vector<std::vector<uint64_t>> cursor(threads); // Per-thread counts, then write positions
+        std::atomic<bool> out_of_range(false);
+        pool.parallel_for(m, [&](int t, long long begin, long long end) {
+            std::vector<uint64_t>& count = cursor[t];
+            count.assign(n, 0);
+            for (uint64_t i = begin; i < (uint64_t)end; ++i) {
+                auto [u, v, x] = get(i);
+                (void)x;
+                if (u >= n || v >= n) {
+                    out_of_range = true;
+                    return;
+                }
+                count[u]++;
+                if (!directed) count[v]++;
+            }
+        });
+        if (out_of_range) fail("edge endpoint out of range");
+
+        pool.parallel_for(n, [&](int, long long begin, long long end) {
+            for (long long u = begin; u < end; ++u) {
+                uint64_t d = 0;
+                for (int t = 0; t < threads; ++t) d += cursor[t][u];
+                g.offset[u + 1] = d;
+            }
+        });
+        for (uint32_t u = 0; u < n; ++u) g.offset[u + 1] += g.offset[u];
+        pool.parallel_for(n, [&](int, long long begin, long long end) {
+            for (long long u = begin; u < end; ++u) {
+                uint64_t p = g.offset[u];
+                for (int t = 0; t < threads; ++t) {
+                    uint64_t c = cursor[t][u];
+                    cursor[t][u] = p;
+                    p += c;
+                }
+            }
+        });
+
+        uint64_t arcs = g.offset[n];
+        g.to.resize(arcs);
+        if (weighted) g.w.resize(arcs);
+        if (with_ids) g.id.resize(arcs);
+        pool.parallel_for(m, [&](int t, long long begin, long long end) {
+            std::vector<uint64_t>& pos = cursor[t];
+            auto place = [&](uint32_t a, uint32_t b, long long x, uint64_t i) {
+                uint64_t p = pos[a]++;
+                g.to[p] = b;
+                if (weighted) g.w[p] = x;
+                if (with_ids) g.id[p] = i;
+            };
+            for (uint64_t i = begin; i < (uint64_t)end; ++i) {
+                auto [u, v, x] = get(i);
+                place(u, v, x, i);
+                if (!directed) place(v, u, x, i);
+            }
+        });
+        return g;
+    }
+
+    static CSRGraph from_edges(uint32_t n, const std::vector<std::pair<int, int>>& edges,
+                               bool directed, bool with_ids = false) {
+        return build(n, edges.size(), [&](uint64_t i) {
+            return std::make_tuple((uint32_t)edges[i].first, (uint32_t)edges[i].second, 0LL);
+        }, directed, false, with_ids);
+    }
+
+    static CSRGraph from_edges(uint32_t n, const std::vector<std::tuple<int, int, long long>>& edges,
+                               bool directed, bool with_ids = false) {
+        return build(n, edges.size(), [&](uint64_t i) {
+            return std::make_tuple((uint32_t)std::get<0>(edges[i]), (uint32_t)std::get<1>(edges[i]),
+                                   std::get<2>(edges[i]));
+        }, directed, true, with_ids);
+    }
+
+    // Binary edge file, all little-endian:
+    //   char magic[8] = "EDGEBIN1", uint64 n, uint64 m, uint64 flags (bit 0: weighted)
+    //   uint32 src[m], uint32 dst[m], then int64 weight[m] if weighted.
+    // n is the number of vertices and must fit in 32 bits. Ids are 0 .. n-1,
+    // or 1 .. n with 'one_based', which builds n + 1 nodes and leaves node 0
+    // for the caller (the same layout the 1-based tools use for stdin input).
+    // The file is memory-mapped and fed to build() directly, so there is no
+    // text parsing and no intermediate copy of the edge list. With 'reversed'
+    // every edge u -> v is read as v -> u.
+    static CSRGraph from_edge_file(const char* path, bool directed, bool with_ids = false,
+                                   bool reversed = false, bool one_based = false) {
+        int fd = open(path, O_RDONLY);
+        struct stat st;
+        if (fd < 0 || fstat(fd, &st) != 0) fail("cannot open edge file ", path);
+        if (st.st_size < 32) fail("malformed edge file ", path);
+        void* base = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        close(fd);
+        if (base == MAP_FAILED) fail("cannot open edge file ", path);
+        madvise(base, st.st_size, MADV_SEQUENTIAL);
+
+        const char* bytes = (const char*)base;
+        uint64_t header[3];
+        std::memcpy(header, bytes + 8, sizeof(header));
+        uint64_t n = header[0], m = header[1];
+        bool weighted = header[2] & 1;
+        uint64_t stride = weighted ? 16 : 8;
+        if (one_based) n++;
+        if (std::memcmp(bytes, "EDGEBIN1", 8) != 0 || n > UINT32_MAX ||
+            m > ((uint64_t)st.st_size - 32) / stride) fail("malformed edge file ", path);
+
+        const uint32_t* src = (const uint32_t*)(bytes + 32);
+        const uint32_t* dst = src + m;
+        if (reversed) std::swap(src, dst);
+        const long long* wt = (const long long*)(bytes + 32 + 8 * m);
+        CSRGraph g = build(n, m, [&](uint64_t i) {
+            return std::make_tuple(src[i], dst[i], weighted ? wt[i] : 0LL);
+        }, directed, weighted, with_ids);
+        munmap(base, st.st_size);
+        return g;
+    }
+
+    // Writes edges in the format read by from_edge_file().
+    static void write_edge_file(const char* path, uint64_t n, const std::vector<uint32_t>& src,
+                                const std::vector<uint32_t>& dst, const std::vector<long long>* weight) {
+        FILE* f = fopen(path, "wb");
+        if (!f) fail("cannot write edge file ", path);
+        uint64_t header[3] = {n, src.size(), weight ? 1ULL : 0ULL};
+        fwrite("EDGEBIN1", 1, 8, f);
+        fwrite(header, sizeof(uint64_t), 3, f);
+        fwrite(src.data(), sizeof(uint32_t), src.size(), f);
+        fwrite(dst.data(), sizeof(uint32_t), dst.size(), f);
+        if (weight) fwrite(weight->data(), sizeof(long long), weight->size(), f);
+        fclose(f);
+    }
+
+    static void fail(const char* msg, const char* path = "") {
+        std::cerr << msg << path << "\n";
+        std::exit(1);
+    }
+};
+
+#endif
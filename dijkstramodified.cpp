@@ -1,3 +1,5 @@
+#include "csrgraph.h"
+
 vector<vector<pair<ll,ll> > >graph;
 
 void djkst(int startnode,vector<ll>&kept){
@@ -19,4 +21,639 @@ void djkst(int startnode,vector<ll>&kept){
         }
 
 
-}
\ No newline at end of file
+}
+
+// CSR form of 'graph' for the engines below; CSRGraph comes from csrgraph.h.
+CSRGraph to_csr(const vector<vector<pair<ll,ll> > >&adj){
+        CSRGraph g;
+        g.n=adj.size();
+        g.offset.assign(g.n+1,0);
+        for(uint32_t i=0;i<g.n;i++)g.offset[i+1]=g.offset[i]+adj[i].size();
+        g.to.reserve(g.offset[g.n]);
+        g.w.reserve(g.offset[g.n]);
+        for(auto &row : adj){
+            for(auto &it : row){
+                g.to.push_back(it.first);
+                g.w.push_back(it.second);
+            }
+        }
+        return g;
+}
+
+// Monotone radix heap: every pushed key is >= the last popped key, which holds
+// for the bottleneck relaxation max(w, dist) >= dist. Bucket i holds keys whose
+// highest bit differing from 'last' is bit i-1; pop() only rescans a bucket
+// when the lower ones are empty, so each item moves O(log C) times in total.
+struct RadixHeap{
+    vector<pair<ll,uint32_t> > buckets[65];
+    ll last=0;
+    size_t sz=0;
+
+    static int bucket(ll x,ll last){
+        return x==last?0:64-__builtin_clzll((unsigned long long)(x^last));
+    }
+    bool empty()const{return sz==0;}
+    void push(ll key,uint32_t node){
+        sz++;
+        buckets[bucket(key,last)].push_back(make_pair(key,node));
+    }
+    pair<ll,uint32_t> pop(){
+        if(buckets[0].empty()){
+            int i=1;
+            while(buckets[i].empty())i++;
+            last=min_element(buckets[i].begin(),buckets[i].end())->first;
+            for(auto &x : buckets[i])buckets[bucket(x.first,last)].push_back(x);
+            buckets[i].clear();
+        }
+        sz--;
+        pair<ll,uint32_t> top=buckets[0].back();
+        buckets[0].pop_back();
+        return top;
+    }
+};
+
+// Bucket queue for small non-negative keys: one list per key value and a
+// cursor that only moves forward. Used when every weight is <= maxkey.
+struct BucketQueue{
+    vector<vector<uint32_t> > buckets;
+    ll cur=0;
+    size_t sz=0;
+
+    BucketQueue(ll maxkey):buckets(maxkey+1){}
+    bool empty()const{return sz==0;}
+    void push(ll key,uint32_t node){
+        sz++;
+        buckets[key].push_back(node);
+    }
+    pair<ll,uint32_t> pop(){
+        while(buckets[cur].empty())cur++;
+        sz--;
+        uint32_t node=buckets[cur].back();
+        buckets[cur].pop_back();
+        return make_pair(cur,node);
+    }
+};
+
+template<class Heap>
+void djkst(const CSRGraph &g,int startnode,vector<ll>&kept,Heap &pq){
+        pq.push(0,startnode);
+        kept[startnode]=0;
+        while(!pq.empty()){
+            pair<ll,uint32_t> top=pq.pop();
+            ll dist=top.first;
+            uint32_t node=top.second;
+            if(kept[node]<dist)continue;
+            for(uint64_t e=g.offset[node];e<g.offset[node+1];e++){
+                ll nd=max(g.w[e],dist);
+                if(kept[g.to[e]]>nd){
+                    kept[g.to[e]]=nd;
+                    pq.push(nd,g.to[e]);
+                }
+            }
+        }
+}
+
+// Same contract as djkst() above (kept pre-filled with a large value), on a
+// CSR graph. Weights must be non-negative. Small weights use the bucket queue,
+// everything else the radix heap.
+void djkst(const CSRGraph &g,int startnode,vector<ll>&kept){
+        ll maxw=0;
+        for(ll x : g.w)maxw=max(maxw,x);
+        if(maxw<=(1<<20) && maxw<=(ll)g.n+(ll)g.w.size()){
+            BucketQueue pq(maxw);
+            djkst(g,startnode,kept,pq);
+        }else{
+            RadixHeap pq;
+            djkst(g,startnode,kept,pq);
+        }
+}
+
+// Path metrics for the generic Dijkstra below. Each one is an ordered
+// semiring: combine() extends a path by an edge, better() orders labels,
+// zero() labels the source and worst() labels unreachable nodes.
+struct SumPath{
+    static ll zero(){return 0;}
+    static ll worst(){return LLONG_MAX;}
+    static ll combine(ll d,ll w){return d+w;}
+    static bool better(ll a,ll b){return a<b;}
+};
+// The (max, min) bottleneck metric of djkst(): minimize the heaviest edge.
+struct MinimaxPath{
+    static ll zero(){return 0;}
+    static ll worst(){return LLONG_MAX;}
+    static ll combine(ll d,ll w){return max(d,w);}
+    static bool better(ll a,ll b){return a<b;}
+};
+// Widest path: maximize the lightest edge (capacity).
+struct WidestPath{
+    static ll zero(){return LLONG_MAX;}
+    static ll worst(){return LLONG_MIN;}
+    static ll combine(ll d,ll w){return min(d,w);}
+    static bool better(ll a,ll b){return a>b;}
+};
+
+// Indexed D-ary heap with decrease-key. Holds each node at most once, so it
+// never grows past n entries, unlike the lazy priority_queue in djkst().
+template<int D,class S>
+struct IndexedDaryHeap{
+    vector<uint32_t> heap;
+    vector<int> pos;   // Position of each node in 'heap', -1 if absent
+    vector<ll> key;
+
+    IndexedDaryHeap(int n):pos(n,-1),key(n){}
+    bool empty()const{return heap.empty();}
+
+    void up(int i){
+        uint32_t x=heap[i];
+        while(i>0){
+            int p=(i-1)/D;
+            if(!S::better(key[x],key[heap[p]]))break;
+            heap[i]=heap[p];
+            pos[heap[i]]=i;
+            i=p;
+        }
+        heap[i]=x;
+        pos[x]=i;
+    }
+    void down(int i){
+        uint32_t x=heap[i];
+        int n=heap.size();
+        while(true){
+            int c=i*D+1;
+            if(c>=n)break;
+            int best=c;
+            for(int k=c+1;k<min(c+D,n);k++){
+                if(S::better(key[heap[k]],key[heap[best]]))best=k;
+            }
+            if(!S::better(key[heap[best]],key[x]))break;
+            heap[i]=heap[best];
+            pos[heap[i]]=i;
+            i=best;
+        }
+        heap[i]=x;
+        pos[x]=i;
+    }
+    // Inserts 'node' or improves its key.
+    void push(uint32_t node,ll k){
+        key[node]=k;
+        if(pos[node]==-1){
+            heap.push_back(node);
+            up(heap.size()-1);
+        }else{
+            up(pos[node]);
+        }
+    }
+    // Empties the heap in O(size), leaving it ready for reuse.
+    void clear(){
+        for(uint32_t x : heap)pos[x]=-1;
+        heap.clear();
+    }
+    pair<ll,uint32_t> pop(){
+        uint32_t top=heap[0];
+        pos[top]=-1;
+        uint32_t last=heap.back();
+        heap.pop_back();
+        if(!heap.empty()){
+            heap[0]=last;
+            down(0);
+        }
+        return make_pair(key[top],top);
+    }
+};
+
+// Single-source search for any metric S on a CSR graph. dist is resized and
+// filled: S::worst() for unreachable nodes, S::zero() at the source.
+template<class S,class Heap=IndexedDaryHeap<4,S> >
+struct Dijkstra{
+    static void run(const CSRGraph &g,int startnode,vector<ll>&dist){
+        int n=g.offset.size()-1;
+        dist.assign(n,S::worst());
+        Heap pq(n);
+        dist[startnode]=S::zero();
+        pq.push(startnode,dist[startnode]);
+        while(!pq.empty()){
+            uint32_t node=pq.pop().second;
+            ll d=dist[node];
+            for(uint64_t e=g.offset[node];e<g.offset[node+1];e++){
+                ll nd=S::combine(d,g.w[e]);
+                if(S::better(nd,dist[g.to[e]])){
+                    dist[g.to[e]]=nd;
+                    pq.push(g.to[e],nd);
+                }
+            }
+        }
+    }
+};
+
+// Reusable barrier for a fixed number of threads (std::barrier is C++20).
+struct Barrier{
+    mutex m;
+    condition_variable cv;
+    int count,waiting=0;
+    long long generation=0;
+
+    Barrier(int count):count(count){}
+    void wait(){
+        unique_lock<mutex> lock(m);
+        long long gen=generation;
+        if(++waiting==count){
+            waiting=0;
+            generation++;
+            cv.notify_all();
+        }else{
+            cv.wait(lock,[&]{return gen!=generation;});
+        }
+    }
+};
+
+// Parallel delta-stepping (Meyer and Sanders) for monotone metrics whose
+// better() is '<', i.e. SumPath and MinimaxPath. Labels are grouped into
+// buckets of width delta. The lowest non-empty bucket is settled in phases:
+// edges whose result stays in that bucket ("light") are relaxed until it stops
+// changing, and the remaining ("heavy") edges are relaxed once afterwards.
+// For SumPath this is the usual w < delta split; for MinimaxPath an edge is
+// light when max(d, w) falls in the current bucket.
+// Node v belongs to thread v % T, which alone keeps its buckets and writes
+// dist[v]; other threads send it relaxation requests between barriers.
+// The final labels are the exact fixpoint, so they equal djkst()'s.
+template<class S>
+void delta_stepping(const CSRGraph &g,int startnode,vector<ll>&dist,int num_threads,ll delta=0){
+        int n=g.offset.size()-1;
+        int T=max(1,num_threads);
+        dist.assign(n,S::worst());
+        if(delta<=0){
+            // Default: the largest weight over the average out-degree, as
+            // Meyer and Sanders suggest for random weights
+            ll maxw=0;
+            for(ll x : g.w)maxw=max(maxw,x);
+            ll avgdeg=max<ll>(1,(ll)g.w.size()/max(1,n));
+            delta=max<ll>(1,maxw/avgdeg);
+        }
+        const ll NONE=LLONG_MAX;
+
+        // relaxed[v]: the label v last relaxed its edges with
+        vector<ll> relaxed(n,S::worst());
+        vector<map<ll,vector<uint32_t> > > buckets(T);
+        vector<vector<vector<pair<uint32_t,ll> > > > outbox(T,vector<vector<pair<uint32_t,ll> > >(T));
+        vector<vector<uint32_t> > settled(T);
+        // Per-thread values for the all-reduce steps, double-buffered by call parity
+        vector<ll> shared[2]={vector<ll>(T),vector<ll>(T)};
+        Barrier barrier(T);
+
+        dist[startnode]=S::zero();
+        buckets[startnode%T][S::zero()/delta].push_back(startnode);
+
+        auto worker=[&](int t){
+            int calls=0;
+            auto all_min=[&](ll x){
+                vector<ll>&buf=shared[calls++&1];
+                buf[t]=x;
+                barrier.wait();
+                return *min_element(buf.begin(),buf.end());
+            };
+            // Applies the requests sent to this thread; returns whether one
+            // of them landed in bucket 'cur'.
+            auto apply=[&](ll cur){
+                bool hit=false;
+                for(int src=0;src<T;src++){
+                    for(auto &r : outbox[src][t]){
+                        if(S::better(r.second,dist[r.first])){
+                            dist[r.first]=r.second;
+                            ll b=r.second/delta;
+                            buckets[t][b].push_back(r.first);
+                            hit=hit||b==cur;
+                        }
+                    }
+                }
+                return hit;
+            };
+            auto clear_inbox=[&](){
+                for(int src=0;src<T;src++)outbox[src][t].clear();
+            };
+
+            while(true){
+                ll cur=all_min(buckets[t].empty()?NONE:buckets[t].begin()->first);
+                if(cur==NONE)break;
+                settled[t].clear();
+
+                // Light phases: repeat until no label lands in bucket 'cur'
+                while(true){
+                    vector<uint32_t> frontier;
+                    auto it=buckets[t].find(cur);
+                    if(it!=buckets[t].end()){
+                        frontier.swap(it->second);
+                        buckets[t].erase(it);
+                    }
+                    for(uint32_t u : frontier){
+                        if(dist[u]/delta!=cur || relaxed[u]==dist[u])continue; // stale or done
+                        if(relaxed[u]==S::worst())settled[t].push_back(u);
+                        relaxed[u]=dist[u];
+                        for(uint64_t e=g.offset[u];e<g.offset[u+1];e++){
+                            ll nd=S::combine(dist[u],g.w[e]);
+                            if(nd/delta==cur)outbox[t][g.to[e]%T].push_back(make_pair(g.to[e],nd));
+                        }
+                    }
+                    barrier.wait();
+                    bool hit=apply(cur);
+                    barrier.wait();
+                    clear_inbox();
+                    if(all_min(hit?0:1)==1)break;
+                }
+
+                // Heavy phase: every edge leaving the bucket, once, from final labels
+                for(uint32_t u : settled[t]){
+                    for(uint64_t e=g.offset[u];e<g.offset[u+1];e++){
+                        ll nd=S::combine(dist[u],g.w[e]);
+                        if(nd/delta!=cur)outbox[t][g.to[e]%T].push_back(make_pair(g.to[e],nd));
+                    }
+                }
+                barrier.wait();
+                apply(cur);
+                barrier.wait();
+                clear_inbox();
+            }
+        };
+
+        vector<thread> threads;
+        for(int t=1;t<T;t++)threads.emplace_back(worker,t);
+        worker(0);
+        for(auto &th : threads)th.join();
+}
+
+// Point-to-point queries that stop as soon as the answer is certain, instead
+// of settling the whole graph like djkst(). g is the graph and rg its reverse
+// (pass the same graph twice if it is undirected). Labels are reset through a
+// touched list, so a query costs only what it explores.
+struct PointToPoint{
+    const CSRGraph &g,&rg;
+    int n;
+    vector<ll> df,db;          // Forward labels from s, backward labels to t
+    vector<uint32_t> touched;
+    IndexedDaryHeap<4,MinimaxPath> hf,hb;
+    IndexedDaryHeap<4,SumPath> hs;
+    // Landmark distances for ALT: from[i][v] = d(L_i, v), to[i][v] = d(v, L_i)
+    vector<vector<ll> > from,to;
+    long long settled=0;       // Nodes settled by the last query
+
+    PointToPoint(const CSRGraph &g,const CSRGraph &rg):g(g),rg(rg),n(g.offset.size()-1),
+        df(n,LLONG_MAX),db(n,LLONG_MAX),hf(n),hb(n),hs(n){}
+
+    void reset(){
+        for(uint32_t v : touched)df[v]=db[v]=LLONG_MAX;
+        touched.clear();
+        hf.clear();
+        hb.clear();
+        hs.clear();
+    }
+
+    // Bottleneck distance from s to t (LLONG_MAX if unreachable), with two
+    // searches: forward from s on g and backward from t on rg, always growing
+    // the one with the smaller key. 'best' is the best s-t path seen through
+    // a scanned edge. Once either search's next key is >= best, that search
+    // alone has settled every node below best, so best is final.
+    ll minimax(int s,int t){
+        settled=0;
+        if(s==t)return 0;
+        ll best=LLONG_MAX;
+        df[s]=0;db[t]=0;
+        touched.push_back(s);touched.push_back(t);
+        hf.push(s,0);hb.push(t,0);
+        while(!hf.empty() && !hb.empty()){
+            bool forward=hf.key[hf.heap[0]]<=hb.key[hb.heap[0]];
+            if(max(hf.key[hf.heap[0]],hb.key[hb.heap[0]])>=best)break;
+            IndexedDaryHeap<4,MinimaxPath> &h=forward?hf:hb;
+            const CSRGraph &G=forward?g:rg;
+            vector<ll> &d=forward?df:db;
+            vector<ll> &other=forward?db:df;
+
+            uint32_t u=h.pop().second;
+            settled++;
+            for(uint64_t e=G.offset[u];e<G.offset[u+1];e++){
+                uint32_t v=G.to[e];
+                ll nd=max(d[u],G.w[e]);
+                if(other[v]!=LLONG_MAX)best=min(best,max(nd,other[v]));
+                if(nd<d[v]){
+                    if(df[v]==LLONG_MAX && db[v]==LLONG_MAX)touched.push_back(v);
+                    d[v]=nd;
+                    h.push(v,nd);
+                }
+            }
+        }
+        reset();
+        return best;
+    }
+
+    // Picks k landmarks by farthest-point selection on the sum metric and
+    // stores distances to and from each of them.
+    void build_landmarks(int k){
+        from.clear();
+        to.clear();
+        vector<ll> mind(n,LLONG_MAX);
+        int l=0;
+        for(int i=0;i<k;i++){
+            from.emplace_back();
+            to.emplace_back();
+            Dijkstra<SumPath>::run(g,l,from.back());
+            Dijkstra<SumPath>::run(rg,l,to.back());
+            // Next landmark: the reachable node farthest from all chosen ones
+            int next=-1;
+            for(int v=0;v<n;v++){
+                if(from.back()[v]==LLONG_MAX)continue;
+                mind[v]=min(mind[v],from.back()[v]);
+                if(next==-1 || mind[v]>mind[next])next=v;
+            }
+            if(next==-1 || mind[next]==0)break;
+            l=next;
+        }
+    }
+
+    // Lower bound on d(v, t) from the triangle inequality over landmarks.
+    ll potential(int v,int t)const{
+        ll h=0;
+        for(size_t i=0;i<from.size();i++){
+            if(from[i][t]!=LLONG_MAX && from[i][v]!=LLONG_MAX)h=max(h,from[i][t]-from[i][v]);
+            if(to[i][v]!=LLONG_MAX && to[i][t]!=LLONG_MAX)h=max(h,to[i][v]-to[i][t]);
+        }
+        return h;
+    }
+
+    // Shortest sum distance from s to t (LLONG_MAX if unreachable). Goal
+    // directed (A* with landmark potentials) after build_landmarks(); plain
+    // Dijkstra with early exit at t otherwise.
+    ll shortest(int s,int t){
+        settled=0;
+        ll ans=LLONG_MAX;
+        df[s]=0;
+        touched.push_back(s);
+        hs.push(s,potential(s,t));
+        while(!hs.empty()){
+            uint32_t u=hs.pop().second;
+            settled++;
+            if((int)u==t){
+                ans=df[u];
+                break;
+            }
+            for(uint64_t e=g.offset[u];e<g.offset[u+1];e++){
+                uint32_t v=g.to[e];
+                ll nd=df[u]+g.w[e];
+                if(nd<df[v]){
+                    if(df[v]==LLONG_MAX)touched.push_back(v);
+                    df[v]=nd;
+                    hs.push(v,nd+potential(v,t));
+                }
+            }
+        }
+        reset();
+        return ans;
+    }
+};
+
+#ifdef BENCHMARK
+// Times the adjacency-list djkst() against the CSR versions on grid, random
+// and power-law graphs, and checks that all of them agree.
+void run_benchmark(){
+        const ll INF=LLONG_MAX;
+        mt19937 rng(99);
+        auto run=[&](string name,int n,vector<tuple<int,int,ll> >&edges){
+            graph.assign(n,{});
+            for(auto &e : edges){
+                graph[get<0>(e)].push_back(make_pair(get<1>(e),get<2>(e)));
+            }
+            CSRGraph g=to_csr(graph);
+            vector<ll> a(n,INF),b(n,INF),c(n,INF);
+
+            auto t0=chrono::steady_clock::now();
+            djkst(0,a);
+            auto t1=chrono::steady_clock::now();
+            RadixHeap rh;
+            djkst(g,0,b,rh);
+            auto t2=chrono::steady_clock::now();
+            djkst(g,0,c);
+            auto t3=chrono::steady_clock::now();
+
+            auto secs=[](chrono::steady_clock::time_point x,chrono::steady_clock::time_point y){
+                return chrono::duration<double>(y-x).count();
+            };
+            cout<<name<<": adjacency+pq "<<secs(t0,t1)<<" s, csr+radix "<<secs(t1,t2)
+                <<" s, csr+auto "<<secs(t2,t3)<<" s"<<(a==b && a==c?"":" (MISMATCH)")<<"\n";
+
+            // Heap arities for the generic engine, minimax and sum metrics
+            vector<ll> d;
+            auto matches=[&](){return a==d;};
+            auto t4=chrono::steady_clock::now();
+            Dijkstra<MinimaxPath,IndexedDaryHeap<2,MinimaxPath> >::run(g,0,d);
+            bool same=matches();
+            auto t5=chrono::steady_clock::now();
+            Dijkstra<MinimaxPath,IndexedDaryHeap<4,MinimaxPath> >::run(g,0,d);
+            same=same && matches();
+            auto t6=chrono::steady_clock::now();
+            Dijkstra<MinimaxPath,IndexedDaryHeap<8,MinimaxPath> >::run(g,0,d);
+            same=same && matches();
+            auto t7=chrono::steady_clock::now();
+            cout<<name<<" minimax: 2-ary "<<secs(t4,t5)<<" s, 4-ary "<<secs(t5,t6)
+                <<" s, 8-ary "<<secs(t6,t7)<<" s"<<(same?"":" (MISMATCH)")<<"\n";
+
+            vector<ll> s2,s4,s8;
+            t4=chrono::steady_clock::now();
+            Dijkstra<SumPath,IndexedDaryHeap<2,SumPath> >::run(g,0,s2);
+            t5=chrono::steady_clock::now();
+            Dijkstra<SumPath,IndexedDaryHeap<4,SumPath> >::run(g,0,s4);
+            t6=chrono::steady_clock::now();
+            Dijkstra<SumPath,IndexedDaryHeap<8,SumPath> >::run(g,0,s8);
+            t7=chrono::steady_clock::now();
+            cout<<name<<" sum: 2-ary "<<secs(t4,t5)<<" s, 4-ary "<<secs(t5,t6)
+                <<" s, 8-ary "<<secs(t6,t7)<<" s"<<(s2==s4 && s2==s8?"":" (MISMATCH)")<<"\n";
+
+            // Point-to-point queries: nodes settled against a full search.
+            // The benchmark graphs are symmetric, so g is its own reverse.
+            {
+                PointToPoint p2p(g,g);
+                const int queries=20;
+                long long bi_settled=0,plain_settled=0,alt_settled=0;
+                bool ok=true;
+                vector<pair<int,int> > pairs;
+                for(int i=0;i<queries;i++)pairs.push_back(make_pair(rng()%n,rng()%n));
+                for(auto &pr : pairs){
+                    vector<ll> full;
+                    Dijkstra<MinimaxPath>::run(g,pr.first,full);
+                    ok=ok && p2p.minimax(pr.first,pr.second)==full[pr.second];
+                    bi_settled+=p2p.settled;
+                }
+                for(auto &pr : pairs){
+                    vector<ll> full;
+                    Dijkstra<SumPath>::run(g,pr.first,full);
+                    ok=ok && p2p.shortest(pr.first,pr.second)==full[pr.second];
+                    plain_settled+=p2p.settled;
+                }
+                p2p.build_landmarks(16);
+                for(auto &pr : pairs){
+                    vector<ll> full;
+                    Dijkstra<SumPath>::run(g,pr.first,full);
+                    ok=ok && p2p.shortest(pr.first,pr.second)==full[pr.second];
+                    alt_settled+=p2p.settled;
+                }
+                cout<<name<<" point-to-point, avg settled of "<<n<<": bidirectional minimax "
+                    <<bi_settled/queries<<", sum early-exit "<<plain_settled/queries
+                    <<", sum ALT(16) "<<alt_settled/queries<<(ok?"":" (MISMATCH)")<<"\n";
+            }
+
+            // Delta-stepping scaling for both metrics
+            for(int threads : {1,2,4,8,16,32,64}){
+                vector<ll> dm,ds;
+                auto t8=chrono::steady_clock::now();
+                delta_stepping<MinimaxPath>(g,0,dm,threads);
+                auto t9=chrono::steady_clock::now();
+                delta_stepping<SumPath>(g,0,ds,threads);
+                auto t10=chrono::steady_clock::now();
+                bool ok=equal(a.begin(),a.end(),dm.begin()) && ds==s2;
+                cout<<name<<" delta-stepping "<<threads<<" threads: minimax "<<secs(t8,t9)
+                    <<" s, sum "<<secs(t9,t10)<<" s"<<(ok?"":" (MISMATCH)")<<"\n";
+            }
+        };
+
+        // 2000 x 2000 grid, both directions, weights up to 1000
+        {
+            int side=2000,n=side*side;
+            vector<tuple<int,int,ll> > edges;
+            for(int r=0;r<side;r++)for(int c=0;c<side;c++){
+                int u=r*side+c;
+                if(c+1<side){ll x=rng()%1000;edges.push_back({u,u+1,x});edges.push_back({u+1,u,x});}
+                if(r+1<side){ll x=rng()%1000;edges.push_back({u,u+side,x});edges.push_back({u+side,u,x});}
+            }
+            run("grid",n,edges);
+        }
+        // Uniform random graph, large weights (radix heap path)
+        {
+            int n=1000000,m=8000000;
+            vector<tuple<int,int,ll> > edges;
+            for(int i=0;i<m;i++){
+                int u=rng()%n,v=rng()%n;
+                ll x=rng()%1000000000;
+                edges.push_back({u,v,x});
+                edges.push_back({v,u,x});
+            }
+            run("random",n,edges);
+        }
+        // Power-law degrees: endpoints drawn with probability ~ 1/sqrt(rank)
+        {
+            int n=1000000,m=8000000;
+            vector<tuple<int,int,ll> > edges;
+            auto pick=[&](){
+                double x=(double)rng()/rng.max();
+                return min(n-1,(int)(x*x*n));
+            };
+            for(int i=0;i<m;i++){
+                int u=pick(),v=pick();
+                ll x=rng()%100000;
+                edges.push_back({u,v,x});
+                edges.push_back({v,u,x});
+            }
+            run("power-law",n,edges);
+        }
+}
+
+int main(){
+        run_benchmark();
+        return 0;
+}
+#endif
\ No newline at end of file
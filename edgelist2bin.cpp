@@ -0,0 +1,52 @@
+#include <cstdio>
+#include <cstring>
+#include <vector>
+#include "csrgraph.h"
+
+// Converts a text edge list ("n m", then m lines "u v" or "u v w") into the
+// binary edge file that the graph tools memory-map (see csrgraph.h).
+// The text is parsed once here, so repeated runs on a large graph skip it.
+// Ids are copied as they are and n is the vertex count: the 0-based tools
+// expect ids 0..n-1, and eulerpathtour, like its text input, expects 1..n.
+// Usage: ./edgelist2bin output.bin [-w] < edges.txt   (-w: edges carry a weight)
+
+// Reads the next (possibly negative) integer, skipping anything before it.
+static bool read_int(long long& x) {
+    int c = getchar_unlocked();
+    while (c != EOF && c != '-' && (c < '0' || c > '9')) c = getchar_unlocked();
+    if (c == EOF) return false;
+    bool neg = c == '-';
+    if (neg) c = getchar_unlocked();
+    x = 0;
+    while (c >= '0' && c <= '9') {
+        x = x * 10 + (c - '0');
+        c = getchar_unlocked();
+    }
+    if (neg) x = -x;
+    return true;
+}
+
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s output.bin [-w] < edges.txt\n", argv[0]);
+        return 1;
+    }
+    bool weighted = argc > 2 && strcmp(argv[2], "-w") == 0;
+
+    long long n = 0, m = 0;
+    read_int(n);
+    read_int(m);
+    std::vector<uint32_t> src(m), dst(m);
+    std::vector<long long> weight(weighted ? m : 0);
+    for (long long i = 0; i < m; ++i) {
+        long long u = 0, v = 0;
+        read_int(u);
+        read_int(v);
+        src[i] = u;
+        dst[i] = v;
+        if (weighted) read_int(weight[i]);
+    }
+
+    CSRGraph::write_edge_file(argv[1], n, src, dst, weighted ? &weight : NULL);
+    return 0;
+}
\ No newline at end of file
@@ -2,131 +2,203 @@
 #include <vector>
 #include <numeric>
 #include <algorithm>
-#include <stack>
-#include <set>
-
-// Use a multiset for the adjacency list for efficient edge removal (logarithmic time).
-// This is crucial for performance with large graphs.
-std::vector<std::multiset<int>> adj;
-std::vector<int> degree;
-
-// A simple DFS to check if all vertices with edges are connected.
-void dfs(int u, std::vector<bool>& visited) {
-    visited[u] = true;
-    for (int v : adj[u]) {
-        if (!visited[v]) {
-            dfs(v, visited);
+#include <cstring>
+#include <cstdio>
+#include "csrgraph.h"
+
+// Eulerian path / tour with Hierholzer's algorithm in O(n + m).
+// The graph is a CSRGraph (csrgraph.h) with edge ids. Each vertex keeps a
+// cursor into its arc list, and a bitmap marks used edges, so an undirected
+// edge taken from one end is skipped when the cursor at the other end reaches
+// it. Every arc is looked at once. Nothing is recursive, so long paths
+// cannot overflow the call stack.
+//
+// The tour is streamed out in the order vertices are popped, so no separate
+// path vector is stored or reversed. Hierholzer pops an Euler path backwards
+// (last vertex first), so it is run from the path's end on the reversed
+// graph: an undirected graph is its own reverse and starts at the second odd
+// vertex; a directed one is built with every edge reversed as it is read and
+// starts at the vertex with the extra in-edge. The pops then come out in
+// forward order, from the first odd (or extra out-edge) vertex, and go
+// straight into a buffered writer. The degree and connectivity checks already
+// guarantee that every edge is used, so nothing printed has to be taken back.
+// Memory is still O(n + m): the DFS stack holds one vertex per edge on the
+// current trail and, on typical inputs, grows to nearly m entries.
+
+// Buffered integer writer: formats into a 64 KB buffer and hands full chunks
+// to fwrite, instead of one formatted stream insertion per vertex.
+struct IntWriter {
+    static const size_t SIZE = 1 << 16;
+    char buf[SIZE];
+    size_t len = 0;
+    bool first = true;
+
+    // Writes x, separated by a space from the previous value.
+    void put(uint32_t x) {
+        if (len + 12 > SIZE) flush();
+        if (!first) buf[len++] = ' ';
+        first = false;
+        char digits[10];
+        int k = 0;
+        do {
+            digits[k++] = '0' + x % 10;
+            x /= 10;
+        } while (x);
+        while (k) buf[len++] = digits[--k];
+    }
+
+    void flush() {
+        fwrite(buf, 1, len, stdout);
+        len = 0;
+    }
+
+    ~IntWriter() {
+        buf[len++] = '\n';
+        flush();
+    }
+};
+
+// Disjoint set union for the connectivity check: it sees every edge once,
+// so direction does not matter. p[x] < 0 marks a root.
+struct DSU {
+    std::vector<int> p;
+    DSU(int n) : p(n, -1) {}
+    int find(int x) {
+        while (p[x] >= 0) {
+            if (p[p[x]] >= 0) p[x] = p[p[x]];
+            x = p[x];
         }
+        return x;
+    }
+    void unite(int a, int b) {
+        a = find(a);
+        b = find(b);
+        if (a == b) return;
+        if (p[a] > p[b]) std::swap(a, b);
+        p[a] += p[b];
+        p[b] = a;
     }
-}
+};
 
-int main() {
+// Usage: ./eulerpathtour [-d] [edge file]
+//   -d         the edges are directed (u -> v)
+//   edge file  binary edge file (format in csrgraph.h) instead of stdin; as on
+//              stdin, its header n is the vertex count and vertices are 1..n
+int main(int argc, char* argv[]) {
     // Fast I/O for performance
     std::ios_base::sync_with_stdio(false);
     std::cin.tie(NULL);
 
-    int n, m;
-    std::cin >> n >> m;
-
-    // Use 1-based indexing for vertices, so size is n+1
-    adj.resize(n + 1);
-    degree.resize(n + 1, 0);
+    bool directed = false;
+    const char* file = NULL;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "-d") == 0) directed = true;
+        else file = argv[i];
+    }
 
-    for (int i = 0; i < m; ++i) {
-        int u, v;
-        std::cin >> u >> v;
-        adj[u].insert(v);
-        adj[v].insert(u);
-        degree[u]++;
-        degree[v]++;
+    // Use 1-based indexing for vertices, so the graph has n+1 nodes. Node 0 is
+    // normally unused, but the checks below still cover it, so edges on it are
+    // never silently left out of the tour.
+    CSRGraph g;
+    if (file) {
+        g = CSRGraph::from_edge_file(file, directed, true, directed, true);
+    } else {
+        int n, m;
+        std::cin >> n >> m;
+        std::vector<std::pair<int, int>> edges(m);
+        for (auto& e : edges) {
+            // Directed edges are stored reversed (see the top of the file)
+            if (directed) std::cin >> e.second >> e.first;
+            else std::cin >> e.first >> e.second;
+        }
+        g = CSRGraph::from_edges(n + 1, edges, directed, true);
     }
+    int n = g.n - 1;
+    long long m = directed ? g.to.size() : g.to.size() / 2;
 
     // ============== 1. Pre-computation Checks ==============
 
-    // Check the number of vertices with odd degrees.
-    std::vector<int> odd_degree_nodes;
-    for (int i = 1; i <= n; ++i) {
-        if (degree[i] % 2 != 0) {
-            odd_degree_nodes.push_back(i);
+    // balance[v]: out-degree minus in-degree (directed), or the degree (undirected).
+    // A directed g holds the reversed edges, so its arc u -> v is the edge v -> u.
+    std::vector<long long> balance(n + 1, 0);
+    DSU dsu(n + 1);
+    for (int u = 0; u <= n; ++u) {
+        for (uint32_t v : g.neighbors(u)) {
+            if (directed) {
+                balance[v]++;
+                balance[u]--;
+            } else {
+                balance[u]++;
+            }
+            dsu.unite(u, v);
         }
     }
 
-    // An Eulerian path/tour exists only if there are 0 or 2 odd-degree vertices.
-    if (odd_degree_nodes.size() != 0 && odd_degree_nodes.size() != 2) {
+    // Undirected: 0 or 2 odd-degree vertices. Directed: every vertex balanced,
+    // or one with one extra out-edge (the start) and one with one extra in-edge.
+    int start_node = -1, end_node = -1, bad = 0;
+    for (int i = 0; i <= n; ++i) {
+        if (directed) {
+            if (balance[i] == 1 && start_node == -1) start_node = i;
+            else if (balance[i] == -1 && end_node == -1) end_node = i;
+            else if (balance[i] != 0) bad++;
+        } else if (balance[i] % 2 != 0) {
+            if (start_node == -1) start_node = i;
+            else if (end_node == -1) end_node = i;
+            else bad++;
+        }
+    }
+    if (bad > 0 || (start_node == -1) != (end_node == -1)) {
         std::cout << "IMPOSSIBLE\n";
         return 0;
     }
 
     // Check for connectivity. All vertices with one or more edges must be in
-    // the same connected component.
+    // the same connected component (weakly connected, if directed).
     int first_node = -1;
-    for (int i = 1; i <= n; ++i) {
-        if (!adj[i].empty()) {
-            first_node = i;
-            break;
-        }
-    }
-
-    if (first_node != -1) { // Proceed only if the graph is not empty
-        std::vector<bool> visited(n + 1, false);
-        dfs(first_node, visited);
-
-        for (int i = 1; i <= n; ++i) {
-            if (!adj[i].empty() && !visited[i]) {
+    for (int i = 0; i <= n; ++i) {
+        if (g.degree(i) > 0 || (directed && balance[i] != 0)) {
+            if (first_node == -1) {
+                first_node = i;
+            } else if (dsu.find(i) != dsu.find(first_node)) {
                 std::cout << "IMPOSSIBLE\n"; // Graph is not connected
                 return 0;
             }
         }
     }
 
-    // ============== 2. Hierholzer's Algorithm ==============
+    // ============== 2. Hierholzer's Algorithm, streamed ==============
 
-    // Determine the starting node for the traversal.
-    int start_node = 1; // Default start for a tour
-    if (!odd_degree_nodes.empty()) {
-        start_node = odd_degree_nodes[0]; // Must start at an odd-degree node for a path
-    } else if (first_node != -1) {
-        start_node = first_node; // For a tour, start at any node with edges
+    // Determine the starting node for the traversal: the end of the path,
+    // on the reversed graph (see the top of the file).
+    if (start_node == -1) {
+        start_node = end_node = first_node != -1 ? first_node : 1;
     }
 
-    std::stack<int> st;
-    st.push(start_node);
-    std::vector<int> path;
+    std::vector<uint64_t> next(g.offset.begin(), g.offset.end() - 1); // Per-vertex cursor
+    std::vector<uint64_t> used((m + 63) / 64, 0);                      // Bitmap over edge ids
+    std::vector<int> st;
+    st.push_back(end_node);
+    IntWriter out;
 
     while (!st.empty()) {
-        int u = st.top();
+        int u = st.back();
+        // Skip edges already taken from the other end
+        while (next[u] < g.offset[u + 1] && (used[g.id[next[u]] >> 6] >> (g.id[next[u]] & 63) & 1)) {
+            next[u]++;
+        }
 
-        if (adj[u].empty()) {
+        if (next[u] == g.offset[u + 1]) {
             // If there are no more edges from this vertex, it's the end of a cycle.
-            // Add it to our final path.
-            path.push_back(u);
-            st.pop();
+            // It is the next vertex of the path.
+            out.put(u);
+            st.pop_back();
         } else {
-            // Follow an edge to the next vertex.
-            int v = *adj[u].begin();
-
-            // Remove the edge (u, v) and (v, u) from the graph.
-            adj[u].erase(adj[u].find(v));
-            adj[v].erase(adj[v].find(u));
-            
-            // Add the new vertex to the stack to explore from.
-            st.push(v);
-        }
-    }
-
-    // ============== 3. Final Check and Output ==============
-
-    // If the path contains all edges, print it. Otherwise, it's impossible.
-    // The number of vertices in the path is always one more than the number of edges.
-    if (path.size() != m + 1) {
-        std::cout << "IMPOSSIBLE\n";
-    } else {
-        // The path is constructed in reverse, so we must reverse it.
-        std::reverse(path.begin(), path.end());
-        for (int i = 0; i < path.size(); ++i) {
-            std::cout << path[i] << (i == path.size() - 1 ? "" : " ");
+            // Follow an edge to the next vertex and mark it used.
+            uint32_t id = g.id[next[u]];
+            used[id >> 6] |= 1ULL << (id & 63);
+            st.push_back(g.to[next[u]++]);
         }
-        std::cout << "\n";
     }
 
     return 0;
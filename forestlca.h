@@ -0,0 +1,84 @@
+#ifndef FORESTLCA_H
+#define FORESTLCA_H
+
+#include <vector>
+#include <utility>
+#include "csrgraph.h"
+
+// O(1) lowest common ancestor on a forest kept as an undirected CSRGraph
+// (every tree edge stored in both directions). An iterative Euler tour writes
+// each node on entry and again after each child, and a sparse table over the
+// tour returns the shallowest node in any range. O(n log n) build.
+// Trees are rooted at 'roots' first, in order, then at every node not reached
+// yet, in index order; tree_id[x] is the root of x's tree.
+struct ForestLCA {
+    std::vector<int> depth, first, tree_id, euler;
+    std::vector<std::vector<int>> st; // st[j][i]: shallowest node in euler[i .. i + 2^j)
+    std::vector<int> log_table;
+
+    ForestLCA() {}
+
+    ForestLCA(const CSRGraph& tree, const std::vector<int>& roots = {}) {
+        int nodes = tree.n;
+        depth.assign(nodes, 0);
+        first.assign(nodes, -1);
+        tree_id.assign(nodes, -1);
+        euler.reserve(2 * nodes);
+
+        std::vector<std::pair<int, uint64_t>> stack; // (node, next arc)
+        auto tour = [&](int r) {
+            if (tree_id[r] != -1) return;
+            tree_id[r] = r;
+            stack.push_back({r, tree.offset[r]});
+            while (!stack.empty()) {
+                auto& [x, next] = stack.back();
+                if (first[x] == -1) first[x] = euler.size();
+                euler.push_back(x);
+                // Skip the parent, which is the only visited neighbour
+                while (next < tree.offset[x + 1] && tree_id[tree.to[next]] != -1) next++;
+                if (next < tree.offset[x + 1]) {
+                    int child = tree.to[next++];
+                    tree_id[child] = r;
+                    depth[child] = depth[x] + 1;
+                    stack.push_back({child, tree.offset[child]});
+                } else {
+                    stack.pop_back();
+                }
+            }
+        };
+        for (int r : roots) tour(r);
+        for (int r = 0; r < nodes; ++r) tour(r);
+
+        int len = euler.size();
+        log_table.assign(len + 1, 0);
+        for (int i = 2; i <= len; ++i) log_table[i] = log_table[i / 2] + 1;
+        st.assign(log_table[len] + 1, std::vector<int>(len));
+        st[0] = euler;
+        for (int j = 1; j < (int)st.size(); ++j) {
+            for (int i = 0; i + (1 << j) <= len; ++i) {
+                int a = st[j - 1][i], b = st[j - 1][i + (1 << (j - 1))];
+                st[j][i] = depth[a] < depth[b] ? a : b;
+            }
+        }
+    }
+
+    // Only meaningful when connected(u, v).
+    int lca(int u, int v) const {
+        int l = first[u], r = first[v];
+        if (l > r) std::swap(l, r);
+        int j = log_table[r - l + 1];
+        int a = st[j][l], b = st[j][r - (1 << j) + 1];
+        return depth[a] < depth[b] ? a : b;
+    }
+
+    bool connected(int u, int v) const {
+        return tree_id[u] == tree_id[v];
+    }
+
+    // Number of tree edges between u and v; they must be connected.
+    int dist(int u, int v) const {
+        return depth[u] + depth[v] - 2 * depth[lca(u, v)];
+    }
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,68 @@
+#include <iostream>
+#include <vector>
+#include "lowlink.h"
+
+using namespace std;
+
+// Prints everything the lowlink engine (lowlink.h) finds in one pass.
+int main() {
+    // Fast I/O
+    ios_base::sync_with_stdio(false);
+    cin.tie(NULL);
+
+    int V, E;
+    cout << "Enter number of vertices and edges: ";
+    cin >> V >> E;
+
+    cout << "Enter " << E << " edges (u v):\n";
+    vector<pair<int, int>> edges(E);
+    for (int i = 0; i < E; ++i) {
+        cin >> edges[i].first >> edges[i].second;
+    }
+
+    CSRGraph g = CSRGraph::from_edges(V, edges, false, true);
+    Lowlink lowlink(g);
+
+    cout << "\nBridges are:\n";
+    if (lowlink.bridges.empty()) {
+        cout << "None\n";
+    } else {
+        for (int id : lowlink.bridges) {
+            cout << edges[id].first << " - " << edges[id].second << "\n";
+        }
+    }
+
+    cout << "\nArticulation Points are:\n";
+    bool any = false;
+    for (int v = 0; v < V; ++v) {
+        if (lowlink.is_articulation[v]) {
+            cout << v << " ";
+            any = true;
+        }
+    }
+    cout << (any ? "\n" : "None\n");
+
+    cout << "\nBiconnected Components are:\n";
+    for (int i = 0; i < lowlink.bcc_count(); ++i) {
+        cout << "Component " << i + 1 << ": ";
+        for (int k = lowlink.bcc_offset[i]; k < lowlink.bcc_offset[i + 1]; ++k) {
+            cout << lowlink.bcc_vertices[k] << " ";
+        }
+        cout << "\n";
+    }
+
+    cout << "\nTotal Bridge Components found: " << lowlink.two_edge_count << endl;
+    vector<vector<int>> result(lowlink.two_edge_count);
+    for (int v = 0; v < V; ++v) {
+        result[lowlink.two_edge_component[v]].push_back(v);
+    }
+    for (int i = 0; i < lowlink.two_edge_count; ++i) {
+        cout << "Component " << i + 1 << ": ";
+        for (int node : result[i]) {
+            cout << node << " ";
+        }
+        cout << "\n";
+    }
+
+    return 0;
+}
@@ -0,0 +1,131 @@
+#ifndef LOWLINK_H
+#define LOWLINK_H
+
+#include <vector>
+#include <algorithm>
+#include "csrgraph.h"
+
+// One iterative lowlink DFS that produces, in a single O(V + E) pass:
+//   - bridges (as edge ids),
+//   - articulation points,
+//   - biconnected components (as vertex lists),
+//   - 2-edge-connected components (as a component id per vertex).
+// bridges.cpp, articulationpoints.cpp, biconnectedcomponents.cpp,
+// bridgeconnected.cpp, lowlink.cpp and findBridges() in
+// TarzansAlgoForBridges.cpp all run on it. The graph must be undirected and
+// built with edge ids (see csrgraph.h).
+// The DFS stack is explicit, so path-like graphs cannot overflow the call
+// stack, and the parent edge is skipped by edge id rather than by parent
+// vertex, so parallel edges are handled correctly (a doubled edge is never a
+// bridge).
+struct Lowlink {
+    const CSRGraph& g;
+    int V;
+
+    std::vector<int> disc, low;
+
+    // --- Results ---
+    std::vector<int> bridges;             // Edge ids, in the order they were found
+    std::vector<std::pair<int, int>> bridge_ends; // (parent, child) of each bridge, in the same order
+    std::vector<char> is_articulation;    // 1 if the vertex is an articulation point
+    std::vector<int> bcc_offset;          // Vertices of BCC i are bcc_vertices[bcc_offset[i] .. bcc_offset[i+1])
+    std::vector<int> bcc_vertices;
+    std::vector<int> two_edge_component;  // 2-edge-connected component id of each vertex
+    int two_edge_count = 0;
+
+    explicit Lowlink(const CSRGraph& g) : g(g), V(g.n) {
+        run();
+    }
+
+    void run() {
+        disc.assign(V, -1);
+        low.assign(V, -1);
+        is_articulation.assign(V, 0);
+        two_edge_component.assign(V, -1);
+        bcc_offset.assign(1, 0);
+
+        std::vector<int> parent_edge(V, -1), dfs_stack, bcc_stack, two_edge_stack;
+        std::vector<uint64_t> next(V);
+        int timer = 0;
+
+        for (int root = 0; root < V; ++root) {
+            if (disc[root] != -1) continue;
+            int root_children = 0;
+            disc[root] = low[root] = timer++;
+            next[root] = g.offset[root];
+            dfs_stack.push_back(root);
+            bcc_stack.push_back(root);
+            two_edge_stack.push_back(root);
+
+            while (!dfs_stack.empty()) {
+                int u = dfs_stack.back();
+                if (next[u] < g.offset[u + 1]) {
+                    int v = g.to[next[u]], id = g.id[next[u]];
+                    next[u]++;
+                    // Ignore only the edge we came in by, not every edge to the parent
+                    if (id == parent_edge[u]) continue;
+                    if (disc[v] != -1) { // Back edge
+                        low[u] = std::min(low[u], disc[v]);
+                    } else {             // Tree edge
+                        disc[v] = low[v] = timer++;
+                        parent_edge[v] = id;
+                        next[v] = g.offset[v];
+                        if (u == root) root_children++;
+                        dfs_stack.push_back(v);
+                        bcc_stack.push_back(v);
+                        two_edge_stack.push_back(v);
+                    }
+                    continue;
+                }
+
+                // u is finished; report to its parent p
+                dfs_stack.pop_back();
+                if (dfs_stack.empty()) break;
+                int p = dfs_stack.back();
+                low[p] = std::min(low[p], low[u]);
+
+                if (low[u] > disc[p]) {
+                    // (p, u) is a bridge; u's subtree minus what was already
+                    // cut off is one 2-edge-connected component.
+                    bridges.push_back(parent_edge[u]);
+                    bridge_ends.push_back({p, u});
+                    pop_two_edge(two_edge_stack, u);
+                }
+                if (low[u] >= disc[p]) {
+                    // p separates u's subtree: that subtree plus p is a BCC
+                    if (p != root) is_articulation[p] = 1;
+                    while (true) {
+                        int x = bcc_stack.back();
+                        bcc_stack.pop_back();
+                        bcc_vertices.push_back(x);
+                        if (x == u) break;
+                    }
+                    bcc_vertices.push_back(p);
+                    bcc_offset.push_back(bcc_vertices.size());
+                }
+            }
+
+            if (root_children > 1) is_articulation[root] = 1;
+            // Whatever is left belongs to the root's 2-edge-connected component
+            pop_two_edge(two_edge_stack, root);
+            bcc_stack.pop_back(); // the root itself
+        }
+    }
+
+    // Pops vertices up to and including 'until' into a new 2-edge-connected component.
+    void pop_two_edge(std::vector<int>& st, int until) {
+        while (true) {
+            int x = st.back();
+            st.pop_back();
+            two_edge_component[x] = two_edge_count;
+            if (x == until) break;
+        }
+        two_edge_count++;
+    }
+
+    int bcc_count() const {
+        return bcc_offset.size() - 1;
+    }
+};
+
+#endif
\ No newline at end of file
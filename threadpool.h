@@ -0,0 +1,73 @@
+#ifndef THREADPOOL_H
+#define THREADPOOL_H
+
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+
+// Fixed set of worker threads that run one parallel_for at a time.
+struct ThreadPool {
+    int num_threads;
+    std::vector<std::thread> workers;
+    std::mutex m;
+    std::condition_variable start, done;
+    std::function<void(int, long long, long long)> job;
+    long long job_n = 0;
+    int generation = 0, pending = 0;
+    bool stop = false;
+
+    // Below this many items a loop runs inline on the calling thread.
+    static const long long GRAIN = 2048;
+
+    ThreadPool(int num_threads) : num_threads(num_threads) {
+        for (int t = 1; t < num_threads; ++t) {
+            workers.emplace_back([this, t] {
+                int seen = 0;
+                while (true) {
+                    std::unique_lock<std::mutex> lock(m);
+                    start.wait(lock, [&] { return stop || generation != seen; });
+                    if (stop) return;
+                    seen = generation;
+                    long long n = job_n;
+                    lock.unlock();
+                    job(t, n * t / this->num_threads, n * (t + 1) / this->num_threads);
+                    lock.lock();
+                    if (--pending == 0) done.notify_one();
+                }
+            });
+        }
+    }
+
+    ~ThreadPool() {
+        {
+            std::lock_guard<std::mutex> lock(m);
+            stop = true;
+        }
+        start.notify_all();
+        for (auto& w : workers) w.join();
+    }
+
+    // Runs f(t, begin, end) over contiguous parts of [0, n), part t on thread t.
+    template <typename F>
+    void parallel_for(long long n, F f) {
+        if (num_threads == 1 || n < GRAIN) {
+            f(0, 0, n);
+            return;
+        }
+        {
+            std::lock_guard<std::mutex> lock(m);
+            job = f;
+            job_n = n;
+            pending = num_threads - 1;
+            generation++;
+        }
+        start.notify_all();
+        f(0, 0, n / num_threads);
+        std::unique_lock<std::mutex> lock(m);
+        done.wait(lock, [&] { return pending == 0; });
+    }
+};
+
+#endif
\ No newline at end of file